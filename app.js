@@ -85,17 +85,98 @@ function statusBadge(s) {
   } else {
     transportDot.className = 'status-dot dot-bad';
   }
-  const label = s.transport === 'ble' ? (s.name || 'Bluetooth') : (s.baseUrl || 'Wi‑Fi');
+  const label = s.transport === 'ble' ? (s.name || 'Bluetooth')
+    : s.transport === 'ws' ? `${s.baseUrl || 'Wi‑Fi'} (WebSocket)` : (s.baseUrl || 'Wi‑Fi');
   transportText.textContent = `${s.kind} via ${label}`;
 }
 
+// Device sequence number of the last state we saw, and a copy of that state.
+// Incoming patches must build on `seq`; outgoing patches are diffs against `synced`.
+// `boot` scopes `seq`: the device numbers versions from 1 again after a reboot.
+let boot = null;
+let seq = null;
+let synced = null;
+
+const clone = (v) => JSON.parse(JSON.stringify(v));
+const same = (x, y) => JSON.stringify(x) === JSON.stringify(y);
+
+function applyDeviceData(data) {
+  for (const [k, v] of Object.entries(data)) {
+    if (k === 'la+' || k === 'lb+') {
+      const key = k.slice(0, 2);
+      synced[key] = [...(synced[key] || []), ...v].slice(-4);
+      state[key] = clone(synced[key]);
+    } else {
+      synced[k] = clone(v);
+      state[k] = clone(v);
+    }
+  }
+}
+
+// Latency tracing: with "Trace latency" on, writes carry a correlation id and
+// the device holds its ack until the change is drawn and sent, then reports
+// how long each stage took.
+const traceEl = $('#traceLatency');
+const traced = new Map(); // cid -> performance.now() at send
+let traceSeq = 0;
+
+function withCid(msg) {
+  if (!traceEl?.checked) return msg;
+  const cid = `t${++traceSeq}`;
+  traced.set(cid, performance.now());
+  if (traced.size > 32) traced.delete(traced.keys().next().value);
+  return { ...msg, cid };
+}
+
+function logTrace(msg) {
+  const t0 = traced.get(msg.cid);
+  traced.delete(msg.cid);
+  const tr = msg.data.trace;
+  const ms = (us) => (us / 1000).toFixed(1);
+  // Render and the transports run side by side after apply.
+  const stages = [['queue', tr.queueUs], ['parse', tr.parseUs], ['apply', tr.applyUs],
+    ['render wait', tr.renderWaitUs], ['render', tr.renderUs],
+    ['ble', tr.bleUs], ['sse', tr.sseUs], ['ws', tr.wsUs]].filter(([, us]) => us !== undefined);
+  let slowest = stages.reduce((a, b) => (b[1] > a[1] ? b : a), ['none', 0]);
+  let head = `device ${ms(tr.totalUs)} ms`;
+  if (t0 !== undefined) {
+    const rtt = performance.now() - t0;
+    const linkUs = Math.max(0, rtt * 1000 - tr.totalUs);
+    if (linkUs > slowest[1]) slowest = ['link', linkUs];
+    head = `${rtt.toFixed(1)} ms round trip: link ${ms(linkUs)} ms, ${head}`;
+  }
+  log(`trace ${msg.cid}: ${head} (${stages.map(([n, us]) => `${n} ${ms(us)}`).join(', ')})`
+    + ` slowest: ${slowest[0]}${tr.timedOut ? ' [timed out]' : ''}`);
+}
+
 const t = new Transport({ log });
 t.onMessage = (msg) => {
   log('<=', msg);
+  if (msg.cid && msg.data?.trace) logTrace(msg);
   if (msg.type === 'state') {
     // Merge state from device, preserving client-only fields when absent
-    Object.assign(state, msg.data);
+    synced = clone(msg.data);
+    Object.assign(state, clone(msg.data));
+    boot = msg.boot ?? null;
+    seq = msg.seq ?? null;
+    render();
+  } else if (msg.type === 'patch') {
+    const sameBoot = (msg.boot ?? null) === boot;
+    if (sameBoot && seq === msg.seq) return; // already have it (e.g. BLE and SSE both delivered)
+    if (synced === null || !sameBoot || msg.base !== seq) {
+      log('patch gap: have', seq, 'got base', msg.base, '- resyncing');
+      t.send({ type: 'resync' }).catch(() => {});
+      return;
+    }
+    applyDeviceData(msg.data);
+    seq = msg.seq;
     render();
+  } else if (msg.type === 'error' && msg.data?.code === 'stale') {
+    // Device does not know our base (it rebooted): push our whole state.
+    boot = null;
+    seq = null;
+    synced = null;
+    sendState();
   } else if (msg.type === 'ack') {
     // ignore
   }
@@ -114,8 +195,10 @@ $('#connectBle').addEventListener('click', async () => {
 
 $('#connectWifi').addEventListener('click', async () => {
   const base = $('#wifiBaseUrl').value || 'http://192.168.4.1';
+  // ?wifi=http forces POST + SSE, e.g. to compare round trips with the WebSocket.
+  const websocket = new URLSearchParams(location.search).get('wifi') !== 'http';
   try {
-    await t.connectWifi(base);
+    await t.connectWifi(base, { websocket });
     log('Wi‑Fi connected to', base);
   } catch (e) {
     log('Wi‑Fi error:', e.message || e);
@@ -151,10 +234,10 @@ for (let i = 0; i < 6; i++) {
   if (bi) bi.addEventListener('input', (e) => { state.rb[i] = e.target.value; sendState(); });
 }
 
-$('#plusA').addEventListener('click', () => { addPoint('A', 'Manual +1'); });
-$('#minusA').addEventListener('click', () => { removePoint('A', 'Manual -1'); });
-$('#plusB').addEventListener('click', () => { addPoint('B', 'Manual +1'); });
-$('#minusB').addEventListener('click', () => { removePoint('B', 'Manual -1'); });
+$('#plusA').addEventListener('click', () => command('point', 'A', () => addPoint('A', 'Manual +1')));
+$('#minusA').addEventListener('click', () => command('minus', 'A', () => removePoint('A', 'Manual -1')));
+$('#plusB').addEventListener('click', () => command('point', 'B', () => addPoint('B', 'Manual +1')));
+$('#minusB').addEventListener('click', () => command('minus', 'B', () => removePoint('B', 'Manual -1')));
 
 $('#serveA').addEventListener('change', () => { state.sv = 'A'; sendState(); });
 $('#serveB').addEventListener('change', () => { state.sv = 'B'; sendState(); });
@@ -171,36 +254,74 @@ const wonSetB = document.getElementById('wonSetB');
 const clearSetA = document.getElementById('clearSetA');
 const clearSetB = document.getElementById('clearSetB');
 
-if (sideoutA) sideoutA.addEventListener('click', () => doSideOut('A'));
-if (sideoutB) sideoutB.addEventListener('click', () => doSideOut('B'));
-if (servedScoredA) servedScoredA.addEventListener('click', () => doServedAndScored('A'));
-if (servedScoredB) servedScoredB.addEventListener('click', () => doServedAndScored('B'));
-if (voidPrevA) voidPrevA.addEventListener('click', () => removePoint('A', 'Voided previous point'));
-if (voidPrevB) voidPrevB.addEventListener('click', () => removePoint('B', 'Voided previous point'));
-if (wonSetA) wonSetA.addEventListener('click', () => doWonSet('A'));
-if (wonSetB) wonSetB.addEventListener('click', () => doWonSet('B'));
-if (clearSetA) clearSetA.addEventListener('click', () => doClearSet());
-if (clearSetB) clearSetB.addEventListener('click', () => doClearSet());
+if (sideoutA) sideoutA.addEventListener('click', () => command('sideout', 'A', () => doSideOut('A')));
+if (sideoutB) sideoutB.addEventListener('click', () => command('sideout', 'B', () => doSideOut('B')));
+if (servedScoredA) servedScoredA.addEventListener('click', () => command('served', 'A', () => doServedAndScored('A')));
+if (servedScoredB) servedScoredB.addEventListener('click', () => command('served', 'B', () => doServedAndScored('B')));
+if (voidPrevA) voidPrevA.addEventListener('click', () => command('void', 'A', () => removePoint('A', 'Voided previous point')));
+if (voidPrevB) voidPrevB.addEventListener('click', () => command('void', 'B', () => removePoint('B', 'Voided previous point')));
+if (wonSetA) wonSetA.addEventListener('click', () => command('wonSet', 'A', () => doWonSet('A')));
+if (wonSetB) wonSetB.addEventListener('click', () => command('wonSet', 'B', () => doWonSet('B')));
+if (clearSetA) clearSetA.addEventListener('click', () => command('clearSet', null, () => doClearSet()));
+if (clearSetB) clearSetB.addEventListener('click', () => command('clearSet', null, () => doClearSet()));
 
 $('#setNumber').addEventListener('input', (e) => { state.set = parseInt(e.target.value || '1', 10); sendState(); });
 $('#matchA').addEventListener('input', (e) => { state.ma = parseInt(e.target.value || '0', 10); sendState(); });
 $('#matchB').addEventListener('input', (e) => { state.mb = parseInt(e.target.value || '0', 10); sendState(); });
 $('#bestOf').addEventListener('change', (e) => { state.bo = parseInt(e.target.value, 10); sendState(); });
 
-$('#endSet').addEventListener('click', () => {
-  if (state.a > state.b) state.ma++; else if (state.b > state.a) state.mb++;
-  state.a = 0; state.b = 0; state.set++;
+$('#endSet').addEventListener('click', () => command('endSet', null, () => {
+  if (state.a > state.b) state.ma = Math.min(state.ma + 1, 9);
+  else if (state.b > state.a) state.mb = Math.min(state.mb + 1, 9);
+  state.a = 0; state.b = 0; state.set = Math.min(state.set + 1, 9);
   render(); sendState();
-});
-$('#undo').addEventListener('click', () => {
-  // Simple logical undo demo (in practice, keep a stack)
-  log('Undo not implemented: keep a stack if needed.');
-});
+}));
+// Undo/redo history lives on the device, shared by every controller.
+$('#undo').addEventListener('click', () => command('undo', null, () => log('Undo needs a connected scoreboard.')));
+$('#redo').addEventListener('click', () => command('redo', null, () => log('Redo needs a connected scoreboard.')));
 
 $('#clearLog').addEventListener('click', () => logEl.textContent = '');
 
+// Fields of `state` that differ from what the device last reported. Logs that
+// only grew are sent as 'la+'/'lb+' appends so a point fits one BLE packet.
+function diffState() {
+  const data = {};
+  for (const [k, v] of Object.entries(state)) {
+    if (same(v, synced[k])) continue;
+    if (k === 'la' || k === 'lb') {
+      const prev = synced[k] || [];
+      let appended = null;
+      for (let n = 1; n <= Math.min(v.length, 4) && appended === null; n++) {
+        if (same([...prev, ...v.slice(-n)].slice(-4), v.slice(-4))) appended = v.slice(-n);
+      }
+      if (appended) { data[k + '+'] = appended; continue; }
+    }
+    data[k] = v;
+  }
+  return data;
+}
+
+// Scoring goes to the device as a command once it has reported its state; the
+// result comes back as a patch. Before that, `offline` applies it locally.
+async function command(op, team, offline) {
+  if (synced === null) { offline(); return; }
+  let msg = { type: 'cmd', op, ts: Date.now() };
+  if (team) msg.team = team;
+  msg = withCid(msg);
+  log('=>', msg);
+  try {
+    await t.send(msg);
+  } catch (e) {
+    log('send error:', e.message || e);
+  }
+}
+
 async function sendState() {
-  const msg = { type: 'state', data: state };
+  let msg = (seq === null || synced === null)
+    ? { type: 'state', data: state }
+    : { type: 'patch', ...(boot !== null && { boot }), base: seq, data: diffState() };
+  if (msg.type === 'patch' && Object.keys(msg.data).length === 0) return;
+  msg = withCid(msg);
   log('=>', msg);
   try {
     await t.send(msg);
@@ -286,9 +407,10 @@ function doServedAndScored(team) {
 }
 
 function doWonSet(team) {
-  if (team === 'A') state.ma++; else state.mb++;
+  // Same limits as the device: match wins 0..9, set 1..9.
+  if (team === 'A') state.ma = Math.min(state.ma + 1, 9); else state.mb = Math.min(state.mb + 1, 9);
   addLog(team, 'Won set');
-  state.a = 0; state.b = 0; state.set++;
+  state.a = 0; state.b = 0; state.set = Math.min(state.set + 1, 9);
   render();
   sendState();
 }
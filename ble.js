@@ -1,5 +1,18 @@
 // Web Bluetooth transport using a Nordic UART-style custom service.
 // Replace UUIDs if you use different ones on the ESP32.
+import { encode, decode, isMsgPack } from './msgpack.js';
+
+// Messages larger than one packet travel as fragments, in both directions:
+// [0xF5][msg id][index][count][payload...]. Anything else is a whole message.
+const FRAME_MAGIC = 0xf5;
+const FRAME_HEADER = 4;
+const FRAME_TIMEOUT_MS = 2000;
+// Writes stay at 180 B to be safe with MTU limits (Web Bluetooth doesn't expose
+// the negotiated MTU); the device caps a reassembled message at 4 KB.
+const WRITE_SIZE = 180;
+const MAX_MESSAGE = 4096;
+const RX_LOG_EVERY = 20; // reassembled messages between throughput lines in the log
+
 const SERVICE_UUID = '6e400001-b5a3-f393-e0a9-e50e24dcca9e';
 const TX_CHAR_UUID = '6e400003-b5a3-f393-e0a9-e50e24dcca9e'; // notify (ESP32 -> browser)
 const RX_CHAR_UUID = '6e400002-b5a3-f393-e0a9-e50e24dcca9e'; // write without response (browser -> ESP32)
@@ -11,6 +24,10 @@ export class BleTransport {
     this.server = null;
     this.tx = null;
     this.rx = null;
+    this.codec = 'json'; // switched by the device's reply to hello
+    this.partial = new Map(); // msg id -> { parts, got, t }
+    this.txId = 0;
+    this.stats = { messages: 0, reassembled: 0, dropped: 0, fragments: 0, bytes: 0, since: 0 };
     this.onMessage = () => {};
     this.onStatus = () => {};
   }
@@ -20,6 +37,7 @@ export class BleTransport {
       throw new Error('Web Bluetooth not supported on this browser.');
     }
     this.onStatus({ kind: 'connecting', transport: 'ble' });
+    this.codec = 'json';
     this.device = await navigator.bluetooth.requestDevice({
       filters: [{ services: [SERVICE_UUID] }],
       optionalServices: [SERVICE_UUID]
@@ -34,13 +52,59 @@ export class BleTransport {
     await this.tx.startNotifications();
     this.tx.addEventListener('characteristicvaluechanged', (e) => {
       const v = e.target.value;
-      const str = new TextDecoder().decode(v);
-      try { this.onMessage(JSON.parse(str)); }
-      catch { this.onMessage({ type: 'text', data: str }); }
+      const bytes = this._reassemble(new Uint8Array(v.buffer, v.byteOffset, v.byteLength));
+      if (!bytes) return;
+      let msg;
+      if (isMsgPack(bytes)) {
+        try { msg = decode(bytes); }
+        catch (err) { this.log.log('msgpack decode error:', err.message || err); return; }
+      } else {
+        const str = new TextDecoder().decode(bytes);
+        try { msg = JSON.parse(str); }
+        catch { msg = { type: 'text', data: str }; }
+      }
+      if (msg && msg.codec) this.codec = msg.codec;
+      this.onMessage(msg);
     });
     this.onStatus({ kind: 'connected', transport: 'ble', name: this.device.name || 'BLE device' });
   }
 
+  // Returns a complete message, or null while fragments are still missing.
+  _reassemble(packet) {
+    const now = performance.now();
+    const st = this.stats;
+    if (!st.since) st.since = now;
+    st.fragments++;
+    st.bytes += packet.byteLength;
+    if (packet.byteLength < FRAME_HEADER || packet[0] !== FRAME_MAGIC) {
+      st.messages++;
+      return packet;
+    }
+    const [, id, index, count] = packet;
+    if (count === 0 || index >= count) { st.dropped++; return null; } // bad header, like bleframe::Reassembler
+    for (const [k, p] of this.partial) {
+      if (now - p.t > FRAME_TIMEOUT_MS) this.partial.delete(k);
+    }
+    let p = this.partial.get(id);
+    if (!p || p.parts.length !== count) {
+      p = { parts: new Array(count), got: 0, t: now };
+      this.partial.set(id, p);
+    }
+    if (!p.parts[index]) p.got++;
+    p.parts[index] = packet.slice(FRAME_HEADER);
+    if (p.got < count) return null;
+    this.partial.delete(id);
+    const out = new Uint8Array(p.parts.reduce((n, b) => n + b.byteLength, 0));
+    let off = 0;
+    for (const b of p.parts) { out.set(b, off); off += b.byteLength; }
+    st.messages++;
+    if (++st.reassembled % RX_LOG_EVERY === 0) {
+      const secs = (now - st.since) / 1000;
+      this.log.log(`BLE rx ${st.reassembled} fragmented msgs; avg ${(st.fragments / st.messages).toFixed(1)} frags/msg, ${secs > 0 ? Math.round(st.bytes / secs) : 0} B/s, ${st.dropped} dropped`);
+    }
+    return out;
+  }
+
   status() {
     const connected = !!(this.device && this.device.gatt && this.device.gatt.connected);
     return { kind: connected ? 'connected' : 'disconnected', transport: 'ble', name: this.device?.name };
@@ -48,12 +112,21 @@ export class BleTransport {
 
   async send(obj) {
     if (!this.rx) throw new Error('Not connected');
-    const payload = new TextEncoder().encode(JSON.stringify(obj));
-    // Split into 180B chunks to be safe with MTU limits.
-    const chunkSize = 180;
-    for (let i = 0; i < payload.byteLength; i += chunkSize) {
-      const slice = payload.slice(i, i + chunkSize);
-      await this.rx.writeValueWithoutResponse(slice);
+    const payload = this.codec === 'msgpack' ? encode(obj) : new TextEncoder().encode(JSON.stringify(obj));
+    if (payload.byteLength > MAX_MESSAGE) throw new Error(`Message too large (${payload.byteLength} B)`);
+    if (payload.byteLength <= WRITE_SIZE) {
+      await this.rx.writeValueWithoutResponse(payload);
+      return;
+    }
+    const chunk = WRITE_SIZE - FRAME_HEADER;
+    const count = Math.ceil(payload.byteLength / chunk);
+    const id = this.txId = (this.txId + 1) & 0xff;
+    for (let i = 0; i < count; i++) {
+      const body = payload.subarray(i * chunk, (i + 1) * chunk);
+      const packet = new Uint8Array(FRAME_HEADER + body.byteLength);
+      packet.set([FRAME_MAGIC, id, i, count]);
+      packet.set(body, FRAME_HEADER);
+      await this.rx.writeValueWithoutResponse(packet);
     }
   }
 }
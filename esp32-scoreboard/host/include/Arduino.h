@@ -0,0 +1,194 @@
+#pragma once
+// Host stand-in for the ESP32 Arduino core ([env:native] only). Just what the
+// firmware uses: String, Serial, time, pins, PROGMEM and the ESP heap queries,
+// plus FreeRTOS tasks and mutexes on std::thread (freertos_host.h).
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include "freertos_host.h"
+
+using std::min;
+using std::max;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define IRAM_ATTR
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+
+// ---- Time: since the process started ----
+namespace host {
+inline std::chrono::steady_clock::time_point bootTime() {
+  static const auto t0 = std::chrono::steady_clock::now();
+  return t0;
+}
+} // namespace host
+
+inline uint32_t micros() {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - host::bootTime()).count();
+}
+inline uint32_t millis() { return micros() / 1000; }
+inline void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+inline void delayMicroseconds(uint32_t us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+inline void yield() { std::this_thread::yield(); }
+
+// ---- Pins: writes are dropped, reads come from host::pinLevel ----
+// host::setPin() changes an input's level and runs its ISR, on the caller's
+// thread, when the edge matches the mode it was attached with.
+namespace host {
+struct PinIsr {
+  void (*fn)(void*) = nullptr;
+  void* arg = nullptr;
+  int mode = 0;
+};
+inline int pinLevel[40] = {};
+inline PinIsr pinIsr[40] = {};
+inline void setPin(uint8_t pin, int level) {
+  if (pin >= 40 || pinLevel[pin] == level) return;
+  pinLevel[pin] = level;
+  const PinIsr& isr = pinIsr[pin];
+  if (isr.fn && (isr.mode == CHANGE || isr.mode == (level ? RISING : FALLING))) isr.fn(isr.arg);
+}
+} // namespace host
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t pin) { return pin < 40 ? host::pinLevel[pin] : LOW; }
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+inline void attachInterruptArg(uint8_t irq, void (*isr)(void*), void* arg, int mode) {
+  if (irq < 40) host::pinIsr[irq] = { isr, arg, mode };
+}
+inline void attachInterrupt(uint8_t irq, void (*isr)(), int mode) {
+  attachInterruptArg(irq, [](void* f) { ((void (*)())f)(); }, (void*)isr, mode);
+}
+inline void detachInterrupt(uint8_t irq) { if (irq < 40) host::pinIsr[irq] = {}; }
+
+// ---- String: the subset of Arduino's String the firmware and ArduinoJson use ----
+class String {
+public:
+  String() = default;
+  String(const char* s) : s_(s ? s : "") {}
+  String(const char* s, size_t n) : s_(s, n) {}
+  String(const std::string& s) : s_(s) {}
+  explicit String(char c) : s_(1, c) {}
+  template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, char>::value>>
+  explicit String(T v) : s_(number(v)) {}
+
+  const char* c_str() const { return s_.c_str(); }
+  unsigned length() const { return (unsigned)s_.size(); }
+  bool isEmpty() const { return s_.empty(); }
+  bool reserve(unsigned n) { s_.reserve(n); return true; }
+  char operator[](unsigned i) const { return i < s_.size() ? s_[i] : 0; }
+  char charAt(unsigned i) const { return (*this)[i]; }
+
+  bool concat(const char* s) { s_ += s; return true; }
+  bool concat(const char* s, unsigned n) { s_.append(s, n); return true; }
+  bool concat(char c) { s_ += c; return true; }
+  bool concat(const String& s) { s_ += s.s_; return true; }
+  String& operator+=(const String& s) { s_ += s.s_; return *this; }
+  String& operator+=(const char* s) { s_ += s; return *this; }
+  String& operator+=(char c) { s_ += c; return *this; }
+  template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, char>::value>>
+  String& operator+=(T v) { s_ += number(v); return *this; }
+
+  int indexOf(char c, unsigned from = 0) const { return find(s_.find(c, from)); }
+  int indexOf(const char* s, unsigned from = 0) const { return find(s_.find(s, from)); }
+  int indexOf(const String& s, unsigned from = 0) const { return find(s_.find(s.s_, from)); }
+  bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+  bool endsWith(const String& p) const {
+    return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+  }
+  String substring(unsigned from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+  String substring(unsigned from, unsigned to) const {
+    return from < s_.size() && to > from ? String(s_.substr(from, to - from)) : String();
+  }
+  long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return s_ == (o ? o : ""); }
+  bool operator!=(const String& o) const { return s_ != o.s_; }
+  bool operator!=(const char* o) const { return !(*this == o); }
+  bool operator<(const String& o) const { return s_ < o.s_; }
+
+  const std::string& str() const { return s_; }
+
+private:
+  template <typename T>
+  static std::string number(T v) {
+    if (std::is_floating_point<T>::value) {
+      char buf[32];
+      snprintf(buf, sizeof(buf), "%.2f", (double)v);
+      return buf;
+    }
+    return std::to_string(v);
+  }
+  static int find(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+  std::string s_;
+};
+
+inline String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+inline String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, char b) { String r(a); r += b; return r; }
+template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, char>::value>>
+inline String operator+(const String& a, T b) { String r(a); r += b; return r; }
+
+// ---- Serial: stdout ----
+class HostSerial {
+public:
+  void begin(unsigned long) {}
+  int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vprintf(fmt, ap);
+    va_end(ap);
+    fflush(stdout);
+    return n;
+  }
+  size_t print(const char* s) { return fputs(s, stdout) >= 0 ? strlen(s) : 0; }
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t println(const char* s = "") { size_t n = print(s); puts(""); fflush(stdout); return n + 1; }
+  size_t println(const String& s) { return println(s.c_str()); }
+  size_t println(long v) { size_t n = print(v); puts(""); return n + 1; }
+};
+inline HostSerial Serial;
+
+// ---- ESP: heap figures are whatever the simulator sets ----
+class HostEsp {
+public:
+  uint32_t freeHeap = 200 * 1024;
+  uint32_t minFreeHeap = 180 * 1024;
+  uint32_t maxAllocHeap = 110 * 1024;
+  uint32_t getFreeHeap() const { return freeHeap; }
+  uint32_t getMinFreeHeap() const { return minFreeHeap; }
+  uint32_t getMaxAllocHeap() const { return maxAllocHeap; }
+  uint32_t getHeapSize() const { return 320 * 1024; }
+  // A 1000 MHz "CPU": one cycle per steady_clock nanosecond.
+  uint32_t getCycleCount() const {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - host::bootTime()).count();
+  }
+  uint32_t getCpuFreqMHz() const { return 1000; }
+  void restart() { std::exit(0); }
+};
+inline HostEsp ESP;
+
+inline uint32_t esp_random() { return (uint32_t)rand() * 2654435761u; }
+inline long random(long hi) { return hi > 0 ? rand() % hi : 0; }
+inline long random(long lo, long hi) { return hi > lo ? lo + rand() % (hi - lo) : lo; }
@@ -0,0 +1,2 @@
+#pragma once
+// Host stand-in: ESPAsyncWebServer.h carries everything the firmware needs.
@@ -0,0 +1,477 @@
+#pragma once
+// Host stand-in for ESPAsyncWebServer (mathieucarbou fork): routes, request
+// bodies, paused requests answered later through getThis(), SSE and WebSocket.
+// There are no sockets: the simulator issues requests with
+// AsyncWebServer::host::request() and opens SSE / WebSocket clients with
+// hostConnect(); handlers run on the caller's thread, as on the async_tcp task.
+#include <Arduino.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <strings.h>
+
+enum WebRequestMethod : uint8_t {
+  HTTP_GET = 0x01, HTTP_POST = 0x02, HTTP_DELETE = 0x04, HTTP_PUT = 0x08,
+  HTTP_PATCH = 0x10, HTTP_HEAD = 0x20, HTTP_OPTIONS = 0x40, HTTP_ANY = 0x7F,
+};
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebServerRequest;
+typedef std::weak_ptr<AsyncWebServerRequest> AsyncWebServerRequestPtr;
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, const String&, size_t, uint8_t*, size_t, bool)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, uint8_t*, size_t, size_t, size_t)> ArBodyHandlerFunction;
+typedef std::function<bool(AsyncWebServerRequest*)> ArRequestFilterFunction;
+typedef std::function<size_t(uint8_t*, size_t, size_t)> AwsResponseFiller;
+
+class AsyncWebHeader {
+public:
+  AsyncWebHeader(const String& name, const String& value) : name_(name), value_(value) {}
+  const String& name() const { return name_; }
+  const String& value() const { return value_; }
+private:
+  String name_, value_;
+};
+
+class AsyncWebServerResponse {
+public:
+  AsyncWebServerResponse(int code, const String& type, std::string body)
+    : code_(code), type_(type), body_(std::move(body)) {}
+  void addHeader(const String& name, const String& value, bool replace = true) {
+    if (replace) {
+      for (auto& h : headers_) if (h.name() == name) { h = AsyncWebHeader(name, value); return; }
+    }
+    headers_.emplace_back(name, value);
+  }
+  void setCode(int code) { code_ = code; }
+  int code() const { return code_; }
+  const String& contentType() const { return type_; }
+  const std::string& body() const { return body_; }
+  const std::vector<AsyncWebHeader>& headers() const { return headers_; }
+  const AsyncWebHeader* header(const char* name) const {
+    for (auto& h : headers_) if (!strcasecmp(h.name().c_str(), name)) return &h;
+    return nullptr;
+  }
+private:
+  friend class AsyncWebServerRequest;
+  int code_;
+  String type_;
+  std::string body_;
+  std::vector<AsyncWebHeader> headers_;
+  AwsResponseFiller filler_;
+};
+
+class DefaultHeaders {
+public:
+  static DefaultHeaders& Instance() {
+    static DefaultHeaders d;
+    return d;
+  }
+  void addHeader(const String& name, const String& value) { headers_.emplace_back(name, value); }
+  const std::vector<AsyncWebHeader>& headers() const { return headers_; }
+private:
+  std::vector<AsyncWebHeader> headers_;
+};
+
+class AsyncWebServerRequest : public std::enable_shared_from_this<AsyncWebServerRequest> {
+public:
+  AsyncWebServerRequest(WebRequestMethodComposite method, const String& url, std::vector<AsyncWebHeader> headers)
+    : method_(method), url_(url), headers_(std::move(headers)) {
+    if (const AsyncWebHeader* h = getHeader("Content-Type")) type_ = h->value();
+  }
+  ~AsyncWebServerRequest() { free(_tempObject); }
+
+  void* _tempObject = nullptr;  // freed with free() with the request, as on the device
+
+  WebRequestMethodComposite method() const { return method_; }
+  const String& url() const { return url_; }
+  const String& contentType() const { return type_; }
+  const AsyncWebHeader* getHeader(const char* name) const {
+    for (auto& h : headers_) if (!strcasecmp(h.name().c_str(), name)) return &h;
+    return nullptr;
+  }
+  bool hasHeader(const char* name) const { return getHeader(name) != nullptr; }
+
+  AsyncWebServerResponse* beginResponse(int code, const char* type = "", const String& content = String()) {
+    return new AsyncWebServerResponse(code, type, content.str());
+  }
+  AsyncWebServerResponse* beginResponse(int code, const char* type, const uint8_t* content, size_t len) {
+    return new AsyncWebServerResponse(code, type, std::string((const char*)content, len));
+  }
+  AsyncWebServerResponse* beginChunkedResponse(const char* type, AwsResponseFiller filler) {
+    auto* r = new AsyncWebServerResponse(200, type, std::string());
+    r->filler_ = std::move(filler);
+    return r;
+  }
+  // Chunked bodies are drained here, on the sending task.
+  void send(AsyncWebServerResponse* r) {
+    if (r->filler_) {
+      uint8_t buf[1024];
+      for (size_t index = 0, n; (n = r->filler_(buf, sizeof(buf), index)) > 0; index += n) {
+        r->body_.append((const char*)buf, n);
+      }
+      r->filler_ = nullptr;
+    }
+    for (auto& h : DefaultHeaders::Instance().headers()) {
+      if (!r->header(h.name().c_str())) r->addHeader(h.name(), h.value());
+    }
+    {
+      std::lock_guard<std::mutex> g(m_);
+      if (!response_) response_.reset(r);
+      else delete r;
+    }
+    cv_.notify_all();
+  }
+  void send(int code, const char* type = "", const String& content = String()) { send(beginResponse(code, type, content)); }
+  void pause() { paused_ = true; }
+  bool isPaused() const { return paused_; }
+  AsyncWebServerRequestPtr getThis() { return shared_from_this(); }
+
+  // Host side: the response once one has been sent, waiting up to `ms`.
+  std::shared_ptr<AsyncWebServerResponse> waitResponse(uint32_t ms) {
+    std::unique_lock<std::mutex> g(m_);
+    cv_.wait_for(g, std::chrono::milliseconds(ms), [this] { return (bool)response_; });
+    return response_;
+  }
+
+private:
+  WebRequestMethodComposite method_;
+  String url_;
+  String type_;
+  std::vector<AsyncWebHeader> headers_;
+  bool paused_ = false;
+  std::mutex m_;
+  std::condition_variable cv_;
+  std::shared_ptr<AsyncWebServerResponse> response_;
+};
+
+class AsyncWebHandler {
+public:
+  virtual ~AsyncWebHandler() = default;
+  AsyncWebHandler& setFilter(ArRequestFilterFunction f) { filter_ = std::move(f); return *this; }
+  bool filter(AsyncWebServerRequest* req) const { return !filter_ || filter_(req); }
+private:
+  ArRequestFilterFunction filter_;
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+public:
+  AsyncCallbackWebHandler(const String& uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                          ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody)
+    : uri_(uri), method_(method), onRequest_(std::move(onRequest)), onUpload_(std::move(onUpload)), onBody_(std::move(onBody)) {}
+  bool matches(const AsyncWebServerRequest* req) const { return (req->method() & method_) && req->url() == uri_; }
+  const ArRequestHandlerFunction& onRequest() const { return onRequest_; }
+  const ArBodyHandlerFunction& onBody() const { return onBody_; }
+private:
+  String uri_;
+  WebRequestMethodComposite method_;
+  ArRequestHandlerFunction onRequest_;
+  ArUploadHandlerFunction onUpload_;
+  ArBodyHandlerFunction onBody_;
+};
+
+// ---- Server-sent events ----
+class AsyncEventSource;
+
+class AsyncEventSourceClient {
+public:
+  struct Event {
+    std::string event;
+    uint32_t id;
+    std::string data;
+  };
+  AsyncEventSourceClient(AsyncEventSource* server, uint32_t lastId) : server_(server), lastId_(lastId) {}
+  uint32_t lastId() const { return lastId_; }
+  bool connected() const { return true; }
+  bool send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0) {
+    (void)reconnect;
+    std::lock_guard<std::mutex> g(m_);
+    events_.push_back({ event ? event : "", id, message ? message : "" });
+    return true;
+  }
+  // Messages still in the client's TCP queue. On the host that is whatever the
+  // simulator set with setBacklog(), to play a slow link.
+  size_t packetsWaiting() const { return backlog_; }
+  void setBacklog(size_t n) { backlog_ = n; }
+  std::vector<Event> take() {
+    std::lock_guard<std::mutex> g(m_);
+    std::vector<Event> out(events_.begin(), events_.end());
+    events_.clear();
+    return out;
+  }
+  AsyncEventSource* server() const { return server_; }
+private:
+  AsyncEventSource* server_;
+  uint32_t lastId_;
+  volatile size_t backlog_ = 0;
+  std::mutex m_;
+  std::deque<Event> events_;
+};
+
+typedef std::function<void(AsyncEventSourceClient*)> ArEventHandlerFunction;
+
+class AsyncEventSource : public AsyncWebHandler {
+public:
+  explicit AsyncEventSource(const String& url) : url_(url) {}
+  const String& url() const { return url_; }
+  void onConnect(ArEventHandlerFunction cb) { onConnect_ = std::move(cb); }
+  void onDisconnect(ArEventHandlerFunction cb) { onDisconnect_ = std::move(cb); }
+  size_t count() const {
+    std::lock_guard<std::mutex> g(m_);
+    return clients_.size();
+  }
+  void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0) {
+    std::lock_guard<std::mutex> g(m_);
+    for (auto& c : clients_) c->send(message, event, id, reconnect);
+  }
+
+  // Host side: an EventSource opening the stream (nullptr if the filter
+  // refused it) and closing it again.
+  AsyncEventSourceClient* hostConnect(uint32_t lastId = 0) {
+    AsyncWebServerRequest req(HTTP_GET, url_, {});
+    if (!filter(&req)) return nullptr;
+    AsyncEventSourceClient* c = new AsyncEventSourceClient(this, lastId);
+    {
+      std::lock_guard<std::mutex> g(m_);
+      clients_.emplace_back(c);
+    }
+    if (onConnect_) onConnect_(c);
+    return c;
+  }
+  void hostDisconnect(AsyncEventSourceClient* c) {
+    if (onDisconnect_) onDisconnect_(c);
+    std::lock_guard<std::mutex> g(m_);
+    for (auto it = clients_.begin(); it != clients_.end(); ++it) {
+      if (it->get() == c) { clients_.erase(it); break; }
+    }
+  }
+private:
+  String url_;
+  ArEventHandlerFunction onConnect_, onDisconnect_;
+  mutable std::mutex m_;
+  std::vector<std::unique_ptr<AsyncEventSourceClient>> clients_;
+};
+
+// ---- WebSocket ----
+typedef enum { WS_CONTINUATION = 0x00, WS_TEXT = 0x01, WS_BINARY = 0x02,
+               WS_DISCONNECT = 0x08, WS_PING = 0x09, WS_PONG = 0x0A } AwsFrameType;
+typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PING, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+
+typedef struct {
+  uint8_t message_opcode;
+  uint32_t num;
+  uint8_t final;
+  uint8_t masked;
+  uint8_t opcode;
+  uint64_t len;
+  uint8_t mask[4];
+  uint64_t index;
+} AwsFrameInfo;
+
+class AsyncWebSocket;
+
+class AsyncWebSocketClient {
+public:
+  struct Message {
+    bool binary;
+    std::string data;
+  };
+  static constexpr size_t kQueueLimit = 8;  // WS_MAX_QUEUED_MESSAGES
+
+  AsyncWebSocketClient(AsyncWebSocket* server, uint32_t id) : server_(server), id_(id) {}
+  uint32_t id() const { return id_; }
+  AsyncWebSocket* server() const { return server_; }
+  bool canSend() const { return queued() < kQueueLimit; }
+  void text(const char* p, size_t n) { push(false, p, n); }
+  void text(const String& s) { push(false, s.c_str(), s.length()); }
+  void binary(const uint8_t* p, size_t n) { push(true, (const char*)p, n); }
+  // Host side: everything sent to this client since the last call.
+  std::vector<Message> take() {
+    std::lock_guard<std::mutex> g(m_);
+    std::vector<Message> out(queue_.begin(), queue_.end());
+    queue_.clear();
+    return out;
+  }
+  size_t queued() const {
+    std::lock_guard<std::mutex> g(m_);
+    return queue_.size() + stalled_;
+  }
+  // While set, messages count as still queued, to play a slow link.
+  void setStalled(size_t n) { stalled_ = n; }
+private:
+  void push(bool bin, const char* p, size_t n) {
+    std::lock_guard<std::mutex> g(m_);
+    queue_.push_back({ bin, std::string(p, n) });
+  }
+  AsyncWebSocket* server_;
+  uint32_t id_;
+  volatile size_t stalled_ = 0;
+  mutable std::mutex m_;
+  std::deque<Message> queue_;
+};
+
+typedef std::function<void(AsyncWebSocket*, AsyncWebSocketClient*, AwsEventType, void*, uint8_t*, size_t)> AwsEventHandler;
+
+class AsyncWebSocket : public AsyncWebHandler {
+public:
+  explicit AsyncWebSocket(const String& url) : url_(url) {}
+  const String& url() const { return url_; }
+  void onEvent(AwsEventHandler h) { handler_ = std::move(h); }
+  size_t count() const {
+    std::lock_guard<std::mutex> g(m_);
+    return clients_.size();
+  }
+  AsyncWebSocketClient* client(uint32_t id) {
+    std::lock_guard<std::mutex> g(m_);
+    for (auto& c : clients_) if (c->id() == id) return c.get();
+    return nullptr;
+  }
+  bool availableForWrite(uint32_t id) {
+    AsyncWebSocketClient* c = client(id);
+    return c && c->canSend();
+  }
+  void text(uint32_t id, const char* p, size_t n) { if (auto* c = client(id)) c->text(p, n); }
+  void text(uint32_t id, const String& s) { if (auto* c = client(id)) c->text(s); }
+  void binary(uint32_t id, const uint8_t* p, size_t n) { if (auto* c = client(id)) c->binary(p, n); }
+  void textAll(const char* p, size_t n) {
+    std::lock_guard<std::mutex> g(m_);
+    for (auto& c : clients_) c->text(p, n);
+  }
+  void cleanupClients(uint16_t = 8) {}
+
+  // Host side: a browser connecting, sending one message (as a single frame,
+  // or split into `pieces` TCP reads) and closing.
+  AsyncWebSocketClient* hostConnect() {
+    AsyncWebSocketClient* c = nullptr;
+    {
+      std::lock_guard<std::mutex> g(m_);
+      clients_.emplace_back(new AsyncWebSocketClient(this, ++nextId_));
+      c = clients_.back().get();
+    }
+    if (handler_) handler_(this, c, WS_EVT_CONNECT, nullptr, nullptr, 0);
+    return c;
+  }
+  void hostSend(AsyncWebSocketClient* c, const std::string& msg, bool binary = false, size_t pieces = 1) {
+    AwsFrameInfo info = {};
+    info.message_opcode = info.opcode = binary ? WS_BINARY : WS_TEXT;
+    info.final = 1;
+    info.len = msg.size();
+    size_t step = pieces > 1 ? (msg.size() + pieces - 1) / pieces : msg.size();
+    if (!step) step = 1;
+    for (size_t off = 0; off < msg.size() || (off == 0 && msg.empty()); off += step) {
+      size_t n = std::min(step, msg.size() - off);
+      info.index = off;
+      std::string piece = msg.substr(off, n);
+      if (handler_) handler_(this, c, WS_EVT_DATA, &info, (uint8_t*)&piece[0], n);
+      if (msg.empty()) break;
+    }
+  }
+  void hostDisconnect(AsyncWebSocketClient* c) {
+    if (handler_) handler_(this, c, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+    std::lock_guard<std::mutex> g(m_);
+    for (auto it = clients_.begin(); it != clients_.end(); ++it) {
+      if (it->get() == c) { clients_.erase(it); break; }
+    }
+  }
+private:
+  String url_;
+  AwsEventHandler handler_;
+  mutable std::mutex m_;
+  uint32_t nextId_ = 0;
+  std::vector<std::unique_ptr<AsyncWebSocketClient>> clients_;
+};
+
+// ---- Server ----
+class AsyncWebServer {
+public:
+  explicit AsyncWebServer(uint16_t port) : port_(port) {}
+  AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                              ArUploadHandlerFunction onUpload = nullptr, ArBodyHandlerFunction onBody = nullptr) {
+    routes_.emplace_back(new AsyncCallbackWebHandler(uri, method, std::move(onRequest), std::move(onUpload), std::move(onBody)));
+    return *routes_.back();
+  }
+  AsyncWebHandler& addHandler(AsyncWebHandler* h) { handlers_.push_back(h); return *h; }
+  void begin() { running_ = true; }
+  void end() { running_ = false; }
+  uint16_t port() const { return port_; }
+
+  struct Result {
+    int code = 0;  // 0: no answer within the timeout
+    String contentType;
+    std::string body;
+    std::vector<AsyncWebHeader> headers;
+    const AsyncWebHeader* header(const char* name) const {
+      for (auto& h : headers) if (!strcasecmp(h.name().c_str(), name)) return &h;
+      return nullptr;
+    }
+  };
+
+  // Host side, without blocking: a request in flight, as a client sees it.
+  struct Pending {
+    std::shared_ptr<AsyncWebServerRequest> req;  // null once answered or dropped
+    Result result;
+    // True once answered (filling `result`), waiting up to `ms` for that.
+    bool poll(uint32_t ms = 0) {
+      if (!req) return true;
+      auto resp = req->waitResponse(ms);
+      if (!resp) return false;
+      result.code = resp->code();
+      result.contentType = resp->contentType();
+      result.body = resp->body();
+      result.headers = resp->headers();
+      req.reset();
+      return true;
+    }
+    // The client hangs up; the firmware's weak reference to it expires.
+    void drop() { req.reset(); }
+  };
+
+  // Delivers one request, body in TCP-sized pieces, and returns it. A request
+  // the handler did not pause is settled at once (code 0 if it never answered).
+  Pending start(WebRequestMethodComposite method, const char* url, const std::string& body = std::string(),
+                std::vector<AsyncWebHeader> headers = {}) {
+    Pending out;
+    auto req = std::make_shared<AsyncWebServerRequest>(method, url, std::move(headers));
+    AsyncCallbackWebHandler* route = nullptr;
+    for (auto& r : routes_) if (r->matches(req.get()) && r->filter(req.get())) { route = r.get(); break; }
+    if (!running_ || !route) {
+      out.result.code = 404;
+      return out;
+    }
+    if (route->onBody() && !body.empty()) {
+      const size_t kSegment = 1436;
+      for (size_t off = 0; off < body.size(); off += kSegment) {
+        size_t n = std::min(kSegment, body.size() - off);
+        route->onBody()(req.get(), (uint8_t*)body.data() + off, n, off, body.size());
+      }
+    }
+    if (route->onRequest()) route->onRequest()(req.get());
+    out.req = req;
+    if (!req->isPaused()) {
+      out.poll(0);
+      out.drop();
+    }
+    return out;
+  }
+
+  // Host side: one HTTP request. A paused request is waited on until another
+  // task answers it or `timeoutMs` passes; after that the request is dropped,
+  // like a client hanging up.
+  Result request(WebRequestMethodComposite method, const char* url, const std::string& body = std::string(),
+                 std::vector<AsyncWebHeader> headers = {}, uint32_t timeoutMs = 2000) {
+    Pending p = start(method, url, body, std::move(headers));
+    p.poll(timeoutMs);
+    return p.result;
+  }
+
+private:
+  uint16_t port_;
+  bool running_ = false;
+  std::vector<std::unique_ptr<AsyncCallbackWebHandler>> routes_;
+  std::vector<AsyncWebHandler*> handlers_;
+};
@@ -0,0 +1,167 @@
+#pragma once
+// Host stand-in for LittleFS: an in-memory file system that lasts as long as
+// the process. Enough of fs::FS / fs::File for the journal: flat directories,
+// read / write / append, seek, and directory listing by base name.
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace host {
+struct FsData {
+  std::mutex m;
+  std::map<std::string, std::shared_ptr<std::string>> files;
+  std::map<std::string, bool> dirs;
+  size_t total = 1536 * 1024;
+};
+inline FsData& fsData() {
+  static FsData d;
+  return d;
+}
+} // namespace host
+
+class File {
+public:
+  File() = default;
+  explicit operator bool() const { return (bool)data_ || dir_; }
+
+  size_t write(const uint8_t* p, size_t n) {
+    if (!data_ || !writable_) return 0;
+    std::lock_guard<std::mutex> g(host::fsData().m);
+    data_->append((const char*)p, n);
+    pos_ = data_->size();
+    return n;
+  }
+  size_t write(uint8_t b) { return write(&b, 1); }
+  size_t read(uint8_t* buf, size_t n) {
+    if (!data_) return 0;
+    std::lock_guard<std::mutex> g(host::fsData().m);
+    size_t avail = pos_ < data_->size() ? data_->size() - pos_ : 0;
+    if (n > avail) n = avail;
+    memcpy(buf, data_->data() + pos_, n);
+    pos_ += n;
+    return n;
+  }
+  bool seek(size_t pos) {
+    if (!data_) return false;
+    std::lock_guard<std::mutex> g(host::fsData().m);
+    if (pos > data_->size()) return false;
+    pos_ = pos;
+    return true;
+  }
+  size_t position() const { return pos_; }
+  size_t size() const {
+    if (!data_) return 0;
+    std::lock_guard<std::mutex> g(host::fsData().m);
+    return data_->size();
+  }
+  void flush() {}
+  void close() { data_.reset(); dir_ = false; }
+  bool isDirectory() const { return dir_; }
+  const char* path() const { return path_.c_str(); }
+  const char* name() const {
+    size_t slash = path_.rfind('/');
+    return path_.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+  }
+
+  // Next entry of a directory opened with LittleFS.open(dir).
+  File openNextFile() {
+    File f;
+    if (!dir_) return f;
+    std::lock_guard<std::mutex> g(host::fsData().m);
+    std::string prefix = path_ + "/";
+    for (auto& kv : host::fsData().files) {
+      const std::string& p = kv.first;
+      if (p.compare(0, prefix.size(), prefix) != 0 || p.find('/', prefix.size()) != std::string::npos) continue;
+      if (!last_.empty() && p <= last_) continue;
+      last_ = p;
+      f.path_ = p;
+      f.data_ = kv.second;
+      return f;
+    }
+    return f;
+  }
+
+private:
+  friend class HostFS;
+  std::string path_;
+  std::shared_ptr<std::string> data_;
+  size_t pos_ = 0;
+  bool writable_ = false;
+  bool dir_ = false;
+  std::string last_;
+};
+
+class HostFS {
+public:
+  bool begin(bool formatOnFail = false, const char* = "/littlefs", uint8_t = 10, const char* = nullptr) {
+    (void)formatOnFail;
+    return true;
+  }
+  void end() {}
+
+  File open(const char* path, const char* mode = "r") {
+    File f;
+    auto& d = host::fsData();
+    std::lock_guard<std::mutex> g(d.m);
+    std::string p = trim(path);
+    f.path_ = p;
+    if (d.dirs.count(p)) { f.dir_ = true; return f; }
+    auto it = d.files.find(p);
+    if (mode[0] == 'r') {
+      if (it == d.files.end()) return File();
+      f.data_ = it->second;
+      f.writable_ = mode[1] == '+';
+      return f;
+    }
+    if (it == d.files.end() || mode[0] == 'w') {
+      auto data = std::make_shared<std::string>();
+      d.files[p] = data;
+      f.data_ = data;
+    } else {
+      f.data_ = it->second;
+    }
+    f.writable_ = true;
+    f.pos_ = f.data_->size();
+    return f;
+  }
+  File open(const String& path, const char* mode = "r") { return open(path.c_str(), mode); }
+
+  bool exists(const char* path) {
+    std::lock_guard<std::mutex> g(host::fsData().m);
+    std::string p = trim(path);
+    return host::fsData().files.count(p) || host::fsData().dirs.count(p);
+  }
+  bool mkdir(const char* path) {
+    std::lock_guard<std::mutex> g(host::fsData().m);
+    host::fsData().dirs[trim(path)] = true;
+    return true;
+  }
+  bool remove(const char* path) {
+    std::lock_guard<std::mutex> g(host::fsData().m);
+    return host::fsData().files.erase(trim(path)) > 0;
+  }
+  bool format() {
+    std::lock_guard<std::mutex> g(host::fsData().m);
+    host::fsData().files.clear();
+    host::fsData().dirs.clear();
+    return true;
+  }
+  size_t totalBytes() { return host::fsData().total; }
+  size_t usedBytes() {
+    std::lock_guard<std::mutex> g(host::fsData().m);
+    size_t n = 0;
+    for (auto& kv : host::fsData().files) n += kv.second->size();
+    return n;
+  }
+
+private:
+  static std::string trim(const char* path) {
+    std::string p = path ? path : "";
+    while (p.size() > 1 && p.back() == '/') p.pop_back();
+    return p;
+  }
+};
+inline HostFS LittleFS;
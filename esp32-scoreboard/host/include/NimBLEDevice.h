@@ -0,0 +1,270 @@
+#pragma once
+// Host stand-in for NimBLE-Arduino 2.x, peripheral side only. There is no
+// radio: the simulator plays the centrals through NimBLEDevice::host, which
+// connects, subscribes and writes by calling the firmware's own callbacks, and
+// collects every notification the firmware sends.
+#include <Arduino.h>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifndef CONFIG_BT_NIMBLE_MAX_CONNECTIONS
+#define CONFIG_BT_NIMBLE_MAX_CONNECTIONS 3
+#endif
+#define BLE_HS_CONN_HANDLE_NONE 0xFFFF
+
+typedef enum { ESP_PWR_LVL_N12 = 0, ESP_PWR_LVL_N9, ESP_PWR_LVL_N6, ESP_PWR_LVL_N3, ESP_PWR_LVL_N0,
+               ESP_PWR_LVL_P3, ESP_PWR_LVL_P6, ESP_PWR_LVL_P9, ESP_PWR_LVL_P7 = ESP_PWR_LVL_P6 } esp_power_level_t;
+
+namespace NIMBLE_PROPERTY {
+enum : uint16_t { READ = 0x02, WRITE_NR = 0x04, WRITE = 0x08, NOTIFY = 0x10, INDICATE = 0x20 };
+}
+
+class NimBLEUUID {
+public:
+  NimBLEUUID() = default;
+  NimBLEUUID(const char* s) : s_(s) {}
+  std::string toString() const { return s_; }
+  bool operator==(const NimBLEUUID& o) const { return s_ == o.s_; }
+private:
+  std::string s_;
+};
+
+class NimBLEConnInfo {
+public:
+  NimBLEConnInfo(uint16_t conn, uint16_t mtu, uint16_t interval) : conn_(conn), mtu_(mtu), interval_(interval) {}
+  uint16_t getConnHandle() const { return conn_; }
+  uint16_t getMTU() const { return mtu_; }
+  uint16_t getConnInterval() const { return interval_; }  // 1.25 ms units
+  uint16_t getConnLatency() const { return 0; }
+  uint16_t getConnTimeout() const { return 400; }
+private:
+  uint16_t conn_, mtu_, interval_;
+};
+
+class NimBLEAttValue {
+public:
+  NimBLEAttValue() = default;
+  NimBLEAttValue(const uint8_t* p, size_t n) : v_(p, p + n) {}
+  const uint8_t* data() const { return v_.data(); }
+  size_t size() const { return v_.size(); }
+  size_t length() const { return v_.size(); }
+private:
+  std::vector<uint8_t> v_;
+};
+
+class NimBLECharacteristic;
+class NimBLEServer;
+
+class NimBLECharacteristicCallbacks {
+public:
+  virtual ~NimBLECharacteristicCallbacks() = default;
+  virtual void onRead(NimBLECharacteristic*, NimBLEConnInfo&) {}
+  virtual void onWrite(NimBLECharacteristic*, NimBLEConnInfo&) {}
+  virtual void onSubscribe(NimBLECharacteristic*, NimBLEConnInfo&, uint16_t) {}
+};
+
+class NimBLECharacteristic {
+public:
+  NimBLECharacteristic(const NimBLEUUID& uuid, uint16_t props) : uuid_(uuid), props_(props) {}
+  const NimBLEUUID& getUUID() const { return uuid_; }
+  void setCallbacks(NimBLECharacteristicCallbacks* cb) { cb_ = cb; }
+  NimBLECharacteristicCallbacks* getCallbacks() const { return cb_; }
+  NimBLEAttValue getValue() const {
+    std::lock_guard<std::mutex> g(m_);
+    return value_;
+  }
+  void setValue(const uint8_t* p, size_t n) {
+    std::lock_guard<std::mutex> g(m_);
+    value_ = NimBLEAttValue(p, n);
+  }
+  // Defined after NimBLEDevice: hands the packet to the simulated central.
+  bool notify(const uint8_t* p, size_t n, uint16_t conn = BLE_HS_CONN_HANDLE_NONE);
+private:
+  NimBLEUUID uuid_;
+  uint16_t props_;
+  NimBLECharacteristicCallbacks* cb_ = nullptr;
+  mutable std::mutex m_;
+  NimBLEAttValue value_;
+};
+
+class NimBLEService {
+public:
+  explicit NimBLEService(const NimBLEUUID& uuid) : uuid_(uuid) {}
+  NimBLECharacteristic* createCharacteristic(const NimBLEUUID& uuid, uint16_t props) {
+    chars_.emplace_back(new NimBLECharacteristic(uuid, props));
+    return chars_.back().get();
+  }
+  NimBLECharacteristic* getCharacteristic(const NimBLEUUID& uuid) {
+    for (auto& c : chars_) if (c->getUUID() == uuid) return c.get();
+    return nullptr;
+  }
+  bool start() { return true; }
+  const NimBLEUUID& getUUID() const { return uuid_; }
+private:
+  NimBLEUUID uuid_;
+  std::vector<std::unique_ptr<NimBLECharacteristic>> chars_;
+};
+
+class NimBLEServerCallbacks {
+public:
+  virtual ~NimBLEServerCallbacks() = default;
+  virtual void onConnect(NimBLEServer*, NimBLEConnInfo&) {}
+  virtual void onDisconnect(NimBLEServer*, NimBLEConnInfo&, int) {}
+  virtual void onMTUChange(uint16_t, NimBLEConnInfo&) {}
+  virtual void onConnParamsUpdate(NimBLEConnInfo&) {}
+};
+
+class NimBLEServer {
+public:
+  void setCallbacks(NimBLEServerCallbacks* cb) { cb_ = cb; }
+  NimBLEServerCallbacks* getCallbacks() const { return cb_; }
+  NimBLEService* createService(const NimBLEUUID& uuid) {
+    services_.emplace_back(new NimBLEService(uuid));
+    return services_.back().get();
+  }
+  NimBLECharacteristic* findCharacteristic(const NimBLEUUID& uuid) {
+    for (auto& s : services_) if (auto* c = s->getCharacteristic(uuid)) return c;
+    return nullptr;
+  }
+  // Defined after NimBLEDevice.
+  bool disconnect(uint16_t conn, uint8_t reason = 0x13);
+private:
+  NimBLEServerCallbacks* cb_ = nullptr;
+  std::vector<std::unique_ptr<NimBLEService>> services_;
+};
+
+class NimBLEAdvertisementData {
+public:
+  void setName(const std::string& name) { name_ = name; }
+  const std::string& name() const { return name_; }
+private:
+  std::string name_;
+};
+
+class NimBLEAdvertising {
+public:
+  bool addServiceUUID(const NimBLEUUID&) { return true; }
+  bool setScanResponseData(const NimBLEAdvertisementData&) { return true; }
+  bool start() { advertising_ = true; return true; }
+  bool stop() { advertising_ = false; return true; }
+  bool isAdvertising() const { return advertising_; }
+private:
+  bool advertising_ = false;
+};
+
+class NimBLEDevice {
+public:
+  static bool init(const std::string& name) { state().name = name; return true; }
+  static bool setMTU(uint16_t mtu) { state().mtu = mtu; return true; }
+  static bool setPower(esp_power_level_t) { return true; }
+  static NimBLEServer* createServer() {
+    if (!state().server) state().server.reset(new NimBLEServer);
+    return state().server.get();
+  }
+  static NimBLEServer* getServer() { return state().server.get(); }
+  static NimBLEAdvertising* getAdvertising() { return &state().adv; }
+  static bool startAdvertising() { return state().adv.start(); }
+  static bool stopAdvertising() { return state().adv.stop(); }
+
+  // The simulated centrals. Calls run the firmware's callbacks on the caller's
+  // thread, as the NimBLE host task would.
+  struct Notification {
+    uint16_t conn;
+    std::vector<uint8_t> bytes;
+  };
+  class host {
+  public:
+    static void connect(uint16_t conn, uint16_t mtu = 247, uint16_t interval = 12) {
+      NimBLEConnInfo info(conn, std::min(mtu, state().mtu), interval);
+      {
+        std::lock_guard<std::mutex> g(state().m);
+        state().links.push_back(info);
+      }
+      if (auto* cb = callbacks()) cb->onConnect(getServer(), info);
+      if (auto* cb = callbacks()) cb->onMTUChange(info.getMTU(), info);
+    }
+    static void disconnect(uint16_t conn, int reason = 0x13) {
+      NimBLEConnInfo info(conn, 23, 12);
+      {
+        std::lock_guard<std::mutex> g(state().m);
+        for (auto it = state().links.begin(); it != state().links.end(); ++it) {
+          if (it->getConnHandle() == conn) { info = *it; state().links.erase(it); break; }
+        }
+      }
+      if (auto* cb = callbacks()) cb->onDisconnect(getServer(), info, reason);
+    }
+    static void subscribe(uint16_t conn, const NimBLEUUID& chr, bool on = true) {
+      NimBLECharacteristic* c = getServer()->findCharacteristic(chr);
+      NimBLEConnInfo info = link(conn);
+      if (c && c->getCallbacks()) c->getCallbacks()->onSubscribe(c, info, on ? 1 : 0);
+    }
+    // One ATT write of `n` bytes (the central splits larger messages itself).
+    static void write(uint16_t conn, const NimBLEUUID& chr, const uint8_t* p, size_t n) {
+      NimBLECharacteristic* c = getServer()->findCharacteristic(chr);
+      if (!c) return;
+      c->setValue(p, n);
+      NimBLEConnInfo info = link(conn);
+      if (c->getCallbacks()) c->getCallbacks()->onWrite(c, info);
+    }
+    // Notifications sent to `conn` since the last call, oldest first.
+    static std::vector<std::vector<uint8_t>> take(uint16_t conn) {
+      std::vector<std::vector<uint8_t>> out;
+      std::lock_guard<std::mutex> g(state().m);
+      auto& q = state().notes;
+      for (auto it = q.begin(); it != q.end();) {
+        if (it->conn == conn) { out.push_back(std::move(it->bytes)); it = q.erase(it); }
+        else ++it;
+      }
+      return out;
+    }
+    // While false, notify() fails as if the controller's buffers were full.
+    static void setAccepting(bool on) { state().accepting = on; }
+    static uint32_t refused() { return state().refused; }
+    static bool advertising() { return state().adv.isAdvertising(); }
+  private:
+    static NimBLEServerCallbacks* callbacks() { return getServer() ? getServer()->getCallbacks() : nullptr; }
+    static NimBLEConnInfo link(uint16_t conn) {
+      std::lock_guard<std::mutex> g(state().m);
+      for (auto& l : state().links) if (l.getConnHandle() == conn) return l;
+      return NimBLEConnInfo(conn, 23, 12);
+    }
+  };
+
+private:
+  friend class NimBLECharacteristic;
+  friend class NimBLEServer;
+  struct State {
+    std::string name;
+    uint16_t mtu = 247;
+    std::unique_ptr<NimBLEServer> server;
+    NimBLEAdvertising adv;
+    std::mutex m;
+    std::vector<NimBLEConnInfo> links;
+    std::deque<Notification> notes;
+    bool accepting = true;
+    uint32_t refused = 0;
+  };
+  static State& state() {
+    static State s;
+    return s;
+  }
+};
+
+inline bool NimBLECharacteristic::notify(const uint8_t* p, size_t n, uint16_t conn) {
+  auto& s = NimBLEDevice::state();
+  std::lock_guard<std::mutex> g(s.m);
+  if (!s.accepting) { s.refused++; return false; }
+  for (auto& l : s.links) {
+    if (conn != BLE_HS_CONN_HANDLE_NONE && l.getConnHandle() != conn) continue;
+    s.notes.push_back({ l.getConnHandle(), std::vector<uint8_t>(p, p + n) });
+  }
+  return true;
+}
+
+inline bool NimBLEServer::disconnect(uint16_t conn, uint8_t reason) {
+  NimBLEDevice::host::disconnect(conn, reason);
+  return true;
+}
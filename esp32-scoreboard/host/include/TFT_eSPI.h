@@ -0,0 +1,271 @@
+#pragma once
+// Host stand-in for TFT_eSPI: the panel is an in-memory RGB565 framebuffer
+// that the simulator can inspect or save as a PPM image. Shapes are drawn
+// exactly; GLCD text is drawn as solid 5x7 cells (no font table), which keeps
+// layout and pixel counts right. Sprites store pixels byte-swapped and
+// pushImage honours setSwapBytes(), as on the device, so a colour-order
+// mistake shows up on the host too.
+#include <Arduino.h>
+#include <cstdarg>
+#include <vector>
+
+#define TFT_RGB 0
+#define TFT_BGR 1
+#if __has_include(<User_Setup.h>)
+#include <User_Setup.h>
+#endif
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 240
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 320
+#endif
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_MAROON      0x7800
+#define TFT_DARKGREY    0x7BEF
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+
+class TFT_eSPI {
+public:
+  explicit TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT) : w0_(w), h0_(h), w_(w), h_(h) {}
+  virtual ~TFT_eSPI() = default;
+
+  void init() {
+    fb_.assign((size_t)w0_ * h0_, 0);
+#ifdef TOUCH_IRQ
+    host::pinLevel[TOUCH_IRQ] = HIGH;  // pulled up while nobody touches
+#endif
+  }
+  void begin() { init(); }
+  void setRotation(uint8_t r) {
+    rotation_ = r & 3;
+    bool swap = rotation_ & 1;
+    w_ = swap ? h0_ : w0_;
+    h_ = swap ? w0_ : h0_;
+  }
+  int16_t width() const { return w_; }
+  int16_t height() const { return h_; }
+
+  // ---- Primitives; everything else is built from these two ----
+  virtual void drawPixel(int32_t x, int32_t y, uint32_t c) {
+    if (x < 0 || y < 0 || x >= w_ || y >= h_) return;
+    fb_[(size_t)y * w_ + x] = (uint16_t)c;
+    pixelsWritten_++;
+  }
+  virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t c) {
+    for (int32_t j = y; j < y + h; j++) for (int32_t i = x; i < x + w; i++) drawPixel(i, j, c);
+  }
+
+  void fillScreen(uint32_t c) { fillRect(0, 0, w_, h_, c); }
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t c) { fillRect(x, y, w, 1, c); }
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t c) { fillRect(x, y, 1, h, c); }
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t c) {
+    drawFastHLine(x, y, w, c); drawFastHLine(x, y + h - 1, w, c);
+    drawFastVLine(x, y, h, c); drawFastVLine(x + w - 1, y, h, c);
+  }
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t c) {
+    int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1, dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1, err = dx + dy;
+    for (;;) {
+      drawPixel(x0, y0, c);
+      if (x0 == x1 && y0 == y1) break;
+      int32_t e2 = 2 * err;
+      if (e2 >= dy) { err += dy; x0 += sx; }
+      if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+  }
+  void fillCircle(int32_t cx, int32_t cy, int32_t r, uint32_t c) {
+    for (int32_t y = -r; y <= r; y++) {
+      int32_t span = (int32_t)std::sqrt((double)(r * r - y * y));
+      drawFastHLine(cx - span, cy + y, 2 * span + 1, c);
+    }
+  }
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t c) {
+    for (int32_t j = 0; j < h; j++) {
+      int32_t inset = cornerInset(j, h, r);
+      drawFastHLine(x + inset, y + j, w - 2 * inset, c);
+    }
+  }
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t c) {
+    drawFastHLine(x + r, y, w - 2 * r, c);
+    drawFastHLine(x + r, y + h - 1, w - 2 * r, c);
+    for (int32_t j = 1; j < h - 1; j++) {
+      int32_t inset = cornerInset(j, h, r);
+      drawPixel(x + inset, y + j, c);
+      drawPixel(x + w - 1 - inset, y + j, c);
+    }
+  }
+  void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t c) {
+    int32_t minY = std::min({ y0, y1, y2 }), maxY = std::max({ y0, y1, y2 });
+    for (int32_t y = minY; y <= maxY; y++) {
+      double lo = 1e9, hi = -1e9;
+      edge(x0, y0, x1, y1, y, lo, hi);
+      edge(x1, y1, x2, y2, y, lo, hi);
+      edge(x2, y2, x0, y0, y, lo, hi);
+      if (lo <= hi) drawFastHLine((int32_t)std::lround(lo), y, (int32_t)std::lround(hi) - (int32_t)std::lround(lo) + 1, c);
+    }
+  }
+
+  // ---- Text (GLCD metrics: 6x8 cells times the text size) ----
+  void setTextFont(uint8_t) {}
+  void setTextSize(uint8_t s) { textSize_ = s ? s : 1; }
+  void setTextColor(uint16_t fg) { fg_ = fg; bgFill_ = false; }
+  void setTextColor(uint16_t fg, uint16_t bg, bool = false) { fg_ = fg; bg_ = bg; bgFill_ = true; }
+  void setCursor(int16_t x, int16_t y) { cx_ = x; cy_ = y; }
+  size_t print(const char* s) {
+    size_t n = 0;
+    for (; *s; s++, n++) writeChar(*s);
+    return n;
+  }
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t print(char c) { writeChar(c); return 1; }
+  size_t print(long v) { char b[24]; snprintf(b, sizeof(b), "%ld", v); return print(b); }
+  size_t println(const char* s = "") { size_t n = print(s); writeChar('\n'); return n + 1; }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    return print(buf);
+  }
+
+  // ---- Images ----
+  void setSwapBytes(bool on) { swapBytes_ = on; }
+  bool getSwapBytes() const { return swapBytes_; }
+  // Without swapping, data is in wire order (big-endian), e.g. a sprite buffer.
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    for (int32_t j = 0; j < h; j++) {
+      for (int32_t i = 0; i < w; i++) {
+        uint16_t v = data[(size_t)j * w + i];
+        drawPixel(x + i, y + j, swapBytes_ ? v : swap16(v));
+      }
+    }
+  }
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) { pushImage(x, y, w, h, (const uint16_t*)data); }
+  void startWrite() {}
+  void endWrite() {}
+  bool initDMA(bool = false) { return true; }
+  void deInitDMA() {}
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* = nullptr) { pushImage(x, y, w, h, data); }
+  bool dmaBusy() { return false; }
+  void dmaWait() {}
+
+  // ---- Touch: set by the simulator ----
+  // hostTouch() also drives TOUCH_IRQ (low while pressed), as the XPT2046
+  // does; touchReads() counts getTouch() calls, each an SPI exchange on a board.
+  bool getTouch(uint16_t* x, uint16_t* y, uint16_t = 600) {
+    touchReads_++;
+    if (!touched_) return false;
+    *x = touchX_;
+    *y = touchY_;
+    return true;
+  }
+  void hostTouch(bool pressed, uint16_t x = 0, uint16_t y = 0) {
+    touchX_ = x;
+    touchY_ = y;
+    touched_ = pressed;
+#ifdef TOUCH_IRQ
+    host::setPin(TOUCH_IRQ, pressed ? LOW : HIGH);
+#endif
+  }
+  uint32_t touchReads() const { return touchReads_; }
+
+  // ---- Host side ----
+  uint16_t pixel(int32_t x, int32_t y) const {
+    return (x < 0 || y < 0 || x >= w_ || y >= h_) ? 0 : fb_[(size_t)y * w_ + x];
+  }
+  uint64_t pixelsWritten() const { return pixelsWritten_; }
+  bool writePPM(const char* path) const {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    fprintf(f, "P6\n%d %d\n255\n", w_, h_);
+    for (int32_t y = 0; y < h_; y++) {
+      for (int32_t x = 0; x < w_; x++) {
+        uint16_t c = pixel(x, y);
+        uint8_t rgb[3] = { (uint8_t)((c >> 11) * 255 / 31), (uint8_t)(((c >> 5) & 0x3F) * 255 / 63), (uint8_t)((c & 0x1F) * 255 / 31) };
+        fwrite(rgb, 1, 3, f);
+      }
+    }
+    fclose(f);
+    return true;
+  }
+
+protected:
+  static uint16_t swap16(uint16_t v) { return (uint16_t)(v << 8 | v >> 8); }
+  bool swapBytes_ = false;
+  int16_t w0_, h0_, w_, h_;
+
+private:
+  static int32_t cornerInset(int32_t j, int32_t h, int32_t r) {
+    int32_t d = j < r ? r - j : (j >= h - r ? j - (h - r - 1) : 0);
+    if (!d) return 0;
+    return r - (int32_t)std::sqrt((double)(r * r - d * d));
+  }
+  static void edge(int32_t xa, int32_t ya, int32_t xb, int32_t yb, int32_t y, double& lo, double& hi) {
+    if ((y < ya && y < yb) || (y > ya && y > yb)) return;
+    double x = ya == yb ? xa : xa + (double)(xb - xa) * (y - ya) / (yb - ya);
+    if (ya == yb) { lo = std::min({ lo, (double)xa, (double)xb }); hi = std::max({ hi, (double)xa, (double)xb }); return; }
+    lo = std::min(lo, x);
+    hi = std::max(hi, x);
+  }
+  void writeChar(char ch) {
+    const int s = textSize_;
+    if (ch == '\n') { cx_ = 0; cy_ += 8 * s; return; }
+    if (bgFill_) fillRect(cx_, cy_, 6 * s, 8 * s, bg_);
+    if (ch != ' ') fillRect(cx_, cy_, 5 * s, 7 * s, fg_);
+    cx_ += 6 * s;
+  }
+
+  uint8_t rotation_ = 0;
+  std::vector<uint16_t> fb_;
+  uint64_t pixelsWritten_ = 0;
+  uint8_t textSize_ = 1;
+  uint16_t fg_ = TFT_WHITE, bg_ = TFT_BLACK;
+  bool bgFill_ = false;
+  int16_t cx_ = 0, cy_ = 0;
+  bool touched_ = false;
+  uint16_t touchX_ = 0, touchY_ = 0;
+  uint32_t touchReads_ = 0;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI*) : TFT_eSPI(0, 0) {}
+  void setColorDepth(int8_t) {}
+  void* createSprite(int16_t w, int16_t h) {
+    buf_.assign((size_t)w * h, 0);
+    w0_ = w_ = w;
+    h0_ = h_ = h;
+    return buf_.data();
+  }
+  void deleteSprite() { buf_.clear(); w0_ = w_ = h0_ = h_ = 0; }
+  void fillSprite(uint32_t c) { fillRect(0, 0, w_, h_, c); }
+  // Stored byte-swapped (wire order), ready for pushImageDMA.
+  void drawPixel(int32_t x, int32_t y, uint32_t c) override {
+    if (x < 0 || y < 0 || x >= w_ || y >= h_ || buf_.empty()) return;
+    buf_[(size_t)y * w_ + x] = swap16((uint16_t)c);
+  }
+  // Native-order data unless setSwapBytes(true) says it is already swapped.
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    for (int32_t j = 0; j < h; j++) {
+      for (int32_t i = 0; i < w; i++) {
+        uint16_t v = data[(size_t)j * w + i];
+        drawPixel(x + i, y + j, swapBytes_ ? swap16(v) : v);
+      }
+    }
+  }
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) { pushImage(x, y, w, h, (const uint16_t*)data); }
+private:
+  std::vector<uint16_t> buf_;
+};
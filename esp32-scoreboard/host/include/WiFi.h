@@ -0,0 +1,33 @@
+#pragma once
+// Host stand-in for the ESP32 WiFi object: the SoftAP always starts and the
+// station is never connected.
+#include <Arduino.h>
+
+class IPAddress {
+public:
+  IPAddress() = default;
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr_((uint32_t)a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+  operator uint32_t() const { return addr_; }
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", addr_ & 0xFF, (addr_ >> 8) & 0xFF, (addr_ >> 16) & 0xFF, addr_ >> 24);
+    return String(buf);
+  }
+private:
+  uint32_t addr_ = 0;
+};
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class HostWiFi {
+public:
+  bool mode(wifi_mode_t m) { mode_ = m; return true; }
+  bool softAP(const char* ssid, const char* pass = nullptr) { ssid_ = ssid; (void)pass; return true; }
+  IPAddress softAPIP() const { return IPAddress(192, 168, 4, 1); }
+  IPAddress localIP() const { return IPAddress(); }
+  String softAPSSID() const { return ssid_; }
+private:
+  wifi_mode_t mode_ = WIFI_OFF;
+  String ssid_;
+};
+inline HostWiFi WiFi;
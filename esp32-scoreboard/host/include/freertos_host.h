@@ -0,0 +1,123 @@
+#pragma once
+// FreeRTOS on std::thread for the native build. Tasks are detached threads,
+// mutexes are timed mutexes and task notifications are a counter plus a
+// condition variable, which is all the firmware uses. Ticks are milliseconds.
+// Core pinning and priorities are accepted and ignored.
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define configTICK_RATE_HZ 1000
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define tskIDLE_PRIORITY 0
+#ifndef ARDUINO_RUNNING_CORE
+#define ARDUINO_RUNNING_CORE 1
+#endif
+
+struct HostTask {
+  std::string name;
+  std::mutex m;
+  std::condition_variable cv;
+  uint32_t notified = 0;
+};
+typedef HostTask* TaskHandle_t;
+
+struct HostSemaphore {
+  std::timed_mutex m;
+};
+typedef HostSemaphore* SemaphoreHandle_t;
+
+namespace host {
+inline HostTask*& taskSlot() {
+  thread_local HostTask* t = nullptr;
+  return t;
+}
+// The task running on this thread; the main thread (setup/loop) gets its own.
+inline HostTask* currentTask() {
+  HostTask*& t = taskSlot();
+  if (!t) t = new HostTask{ "main" };
+  return t;
+}
+} // namespace host
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t, void* arg,
+                                          UBaseType_t, TaskHandle_t* out, BaseType_t) {
+  HostTask* t = new HostTask{ name };
+  if (out) *out = t;
+  std::thread([fn, arg, t] {
+    host::taskSlot() = t;
+    fn(arg);
+  }).detach();
+  return pdPASS;
+}
+
+inline BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack, void* arg,
+                              UBaseType_t prio, TaskHandle_t* out) {
+  return xTaskCreatePinnedToCore(fn, name, stack, arg, prio, out, tskNO_AFFINITY);
+}
+
+inline void vTaskDelay(TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+inline TickType_t xTaskGetTickCount() {
+  static const auto t0 = std::chrono::steady_clock::now();
+  return (TickType_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - t0).count();
+}
+inline BaseType_t xPortGetCoreID() { return 0; }
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return host::currentTask(); }
+// No task registry or real stacks on the host.
+inline TaskHandle_t xTaskGetHandle(const char*) { return nullptr; }
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 0; }
+
+// Never returns on the host: the thread just ends.
+inline void vTaskDelete(TaskHandle_t) {
+  for (;;) std::this_thread::sleep_for(std::chrono::hours(1));
+}
+
+inline void xTaskNotifyGive(TaskHandle_t t) {
+  if (!t) return;
+  {
+    std::lock_guard<std::mutex> g(t->m);
+    t->notified++;
+  }
+  t->cv.notify_one();
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+  HostTask* t = host::currentTask();
+  std::unique_lock<std::mutex> g(t->m);
+  auto ready = [t] { return t->notified > 0; };
+  if (ticks == portMAX_DELAY) t->cv.wait(g, ready);
+  else t->cv.wait_for(g, std::chrono::milliseconds(ticks), ready);
+  uint32_t n = t->notified;
+  if (n) t->notified = clearOnExit ? 0 : n - 1;
+  return n;
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return new HostSemaphore; }
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+  if (ticks == portMAX_DELAY) {
+    s->m.lock();
+    return pdTRUE;
+  }
+  return s->m.try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+  s->m.unlock();
+  return pdTRUE;
+}
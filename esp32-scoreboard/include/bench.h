@@ -0,0 +1,72 @@
+#pragma once
+// Hot-path microbenchmarks (HOT_PATH_BENCH). Times a callable with the CPU
+// cycle counter and counts the heap allocations the calling task makes while
+// it runs; on the host "cycles" are steady_clock nanoseconds.
+//
+// Allocation counting needs the bench envs' linker flags, which route
+// malloc/calloc/realloc through src/bench_alloc.cpp. Without them the counts
+// stay at zero and only the timings are meaningful.
+#include <Arduino.h>
+
+namespace bench {
+
+struct AllocCounters {
+  uint32_t allocs = 0;
+  uint64_t bytes = 0;
+};
+
+// Defined in src/bench_alloc.cpp.
+void trackAllocs(bool on);          // count the calling task's allocations from now on / stop
+AllocCounters allocCounters();      // totals since the last trackAllocs(true)
+
+inline uint32_t cycles() { return ESP.getCycleCount(); }
+inline double cyclesToNs(uint64_t c) { return c * 1000.0 / ESP.getCpuFreqMHz(); }
+
+// Cycles the two counter reads themselves cost; subtracted from every run.
+inline uint32_t timerOverhead() {
+  static uint32_t best = UINT32_MAX;
+  if (best == UINT32_MAX) {
+    for (int i = 0; i < 64; i++) {
+      uint32_t c0 = cycles();
+      uint32_t d = cycles() - c0;
+      if (d < best) best = d;
+    }
+  }
+  return best;
+}
+
+namespace detail {
+static volatile uint32_t sink;
+}
+// Keeps a result alive so the optimiser cannot drop the call that made it.
+inline void keep(uint32_t v) { detail::sink = v; }
+
+struct Result {
+  double nsPerOp;
+  double allocsPerOp;
+  double bytesPerOp;
+};
+
+// Runs fn() `warmup` times untimed, then `runs` times timed. Each run is timed
+// on its own so the 32-bit counter never wraps inside a measurement.
+template <typename Fn>
+Result run(const char* name, uint32_t runs, Fn&& fn, uint32_t warmup = 3) {
+  for (uint32_t i = 0; i < warmup; i++) fn();
+  const uint32_t overhead = timerOverhead();
+  uint64_t total = 0;
+  trackAllocs(true);
+  for (uint32_t i = 0; i < runs; i++) {
+    uint32_t c0 = cycles();
+    fn();
+    uint32_t d = cycles() - c0;
+    total += d > overhead ? d - overhead : 0;
+  }
+  trackAllocs(false);
+  AllocCounters a = allocCounters();
+  Result r = { cyclesToNs(total) / runs, (double)a.allocs / runs, (double)a.bytes / runs };
+  Serial.printf("[BENCH] %-30s %10.0f ns/op %7.1f allocs/op %8.0f B/op (%u runs)\n",
+    name, r.nsPerOp, r.allocsPerOp, r.bytesPerOp, (unsigned)runs);
+  return r;
+}
+
+} // namespace bench
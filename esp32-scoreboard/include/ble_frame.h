@@ -0,0 +1,169 @@
+#pragma once
+#include <Arduino.h>
+
+// Fragment framing for messages larger than one ATT packet, used in both
+// directions (device notifications and browser writes).
+//
+//   [0xF5][msg id][fragment index][fragment count][payload...]
+//
+// A message that fits in a single packet is sent as-is, so small messages
+// cost nothing extra and old clients keep working. 0xF5 can never start a
+// message on its own: JSON starts with '{' and MessagePack messages are maps.
+namespace bleframe {
+
+constexpr uint8_t kMagic = 0xF5;
+constexpr size_t kHeader = 4;
+constexpr size_t kMaxPacket = 512;  // largest ATT payload we ever build
+
+inline bool isFrame(const uint8_t* p, size_t n) { return n >= kHeader && p[0] == kMagic; }
+
+// Packets needed for `n` bytes when each packet carries at most `packet` bytes.
+inline size_t fragmentCount(size_t n, size_t packet) {
+  if (n <= packet) return 1;
+  size_t chunk = packet - kHeader;
+  return (n + chunk - 1) / chunk;
+}
+
+// Call emit(const uint8_t*, size_t) once per packet, in order. Stops and returns
+// false if emit does, or if the message would need more than 255 fragments.
+template <typename Emit>
+bool split(const uint8_t* p, size_t n, size_t packet, uint8_t id, Emit&& emit) {
+  if (packet > kMaxPacket) packet = kMaxPacket;
+  if (n <= packet) return emit(p, n);
+  if (packet <= kHeader) return false;
+  size_t count = fragmentCount(n, packet);
+  if (count > 255) return false;
+  size_t chunk = packet - kHeader;
+  uint8_t buf[kMaxPacket];
+  for (size_t i = 0; i < count; i++) {
+    size_t off = i * chunk;
+    size_t len = n - off < chunk ? n - off : chunk;
+    buf[0] = kMagic;
+    buf[1] = id;
+    buf[2] = (uint8_t)i;
+    buf[3] = (uint8_t)count;
+    memcpy(buf + kHeader, p + off, len);
+    if (!emit(buf, kHeader + len)) return false;
+  }
+  return true;
+}
+
+// Collects one inbound message from RX writes without ever re-parsing.
+//
+// Framed writes are appended in index order into a fixed buffer and the
+// message is complete when the last fragment lands. Unframed writes are a
+// whole message, except from clients that predate framing and still chunk
+// raw JSON: for those a tiny brace scanner (string/escape aware) tracks nesting
+// depth across writes so the message completes exactly when its closing '}'
+// arrives. Either way the caller parses once, the buffer is capped at
+// kMaxMessage, and a message that stalls for kTimeoutMs is dropped.
+class Reassembler {
+public:
+  enum Result : uint8_t { Pending, Complete, Error };
+
+  static constexpr size_t kMaxMessage = 4096;
+  static constexpr uint32_t kTimeoutMs = 2000;
+
+  Result feed(const uint8_t* p, size_t n, uint32_t nowMs) {
+    if (mode_ != Idle && nowMs - started_ > kTimeoutMs) {
+      timeouts++;
+      reset();
+    }
+    if (mode_ == Idle) len_ = 0;
+    if (isFrame(p, n)) return feedFrame(p, n, nowMs);
+    if (mode_ == Framed) return fail("unframed write inside a framed message");
+    if (mode_ == Idle) {
+      // MessagePack is only ever sent framed or in one write.
+      if (n && p[0] != '{' && p[0] != ' ' && p[0] != '\n' && p[0] != '\r' && p[0] != '\t') {
+        if (!append(p, n)) return fail("message too large");
+        return done();
+      }
+      mode_ = Legacy;
+      started_ = nowMs;
+      depth_ = 0; inString_ = escape_ = closed_ = false;
+    }
+    size_t used = scan(p, n);
+    if (!append(p, used)) return fail("message too large");
+    return closed_ ? done() : Pending;
+  }
+
+  const uint8_t* data() const { return buf_; }
+  size_t size() const { return len_; }
+  const char* error() const { return err_; }
+
+  // Drop any partial message (e.g. on disconnect).
+  void reset() { mode_ = Idle; len_ = 0; }
+
+  uint32_t messages = 0, timeouts = 0, errors = 0;
+
+private:
+  enum Mode : uint8_t { Idle, Framed, Legacy };
+
+  Result feedFrame(const uint8_t* p, size_t n, uint32_t nowMs) {
+    uint8_t id = p[1], index = p[2], count = p[3];
+    if (index == 0) {
+      if (mode_ == Legacy) return fail("framed write inside an unframed message");
+      reset();  // a new message supersedes any half-received one
+      if (count == 0) return fail("bad fragment count");
+      mode_ = Framed; id_ = id; count_ = count; next_ = 0; started_ = nowMs;
+      dropId_ = -1;
+    } else if (id == dropId_) {
+      return Pending;  // tail of a message we already rejected
+    } else if (mode_ != Framed || id != id_ || index != next_ || count != count_) {
+      return fail("fragment out of order", id);
+    }
+    if (!append(p + kHeader, n - kHeader)) return fail("message too large", id);
+    if (++next_ < count_) return Pending;
+    return done();
+  }
+
+  // Advance the brace scanner over p; returns how many bytes belong to the
+  // message (anything after the closing brace is ignored).
+  size_t scan(const uint8_t* p, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+      char c = (char)p[i];
+      if (inString_) {
+        if (escape_) escape_ = false;
+        else if (c == '\\') escape_ = true;
+        else if (c == '"') inString_ = false;
+      } else if (c == '"') {
+        inString_ = true;
+      } else if (c == '{' || c == '[') {
+        depth_++;
+      } else if ((c == '}' || c == ']') && depth_ > 0 && --depth_ == 0) {
+        closed_ = true;
+        return i + 1;
+      }
+    }
+    return n;
+  }
+
+  bool append(const uint8_t* p, size_t n) {
+    if (len_ + n > kMaxMessage) return false;
+    memcpy(buf_ + len_, p, n);
+    len_ += n;
+    return true;
+  }
+
+  Result done() { mode_ = Idle; messages++; return Complete; }
+
+  Result fail(const char* why, int dropId = -1) {
+    err_ = why;
+    errors++;
+    reset();
+    dropId_ = dropId;
+    return Error;
+  }
+
+  uint8_t buf_[kMaxMessage];
+  size_t len_ = 0;
+  Mode mode_ = Idle;
+  uint8_t id_ = 0, count_ = 0, next_ = 0;
+  int dropId_ = -1;
+  uint16_t depth_ = 0;
+  bool inString_ = false, escape_ = false, closed_ = false;
+  uint32_t started_ = 0;
+  const char* err_ = "";
+};
+
+} // namespace bleframe
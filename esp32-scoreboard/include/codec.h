@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <string>
+
+// Wire encodings for the message envelope. JSON is the default everywhere (curl,
+// SSE, debugging); MessagePack is opt-in through the hello handshake and is
+// produced/consumed by ArduinoJson from the same JsonDocument.
+enum class Codec : uint8_t { Json = 0, MsgPack = 1 };
+
+inline const char* codecName(Codec c) { return c == Codec::MsgPack ? "msgpack" : "json"; }
+
+inline Codec codecFromName(const char* name) {
+  return (name && strcmp(name, "msgpack") == 0) ? Codec::MsgPack : Codec::Json;
+}
+
+// Messages are always maps. MessagePack maps start with 0x80-0x8f (fixmap),
+// 0xde or 0xdf; anything else (normally '{' or whitespace) is JSON.
+inline Codec sniffCodec(const uint8_t* p, size_t n) {
+  if (!n) return Codec::Json;
+  uint8_t b = p[0];
+  return ((b & 0xF0) == 0x80 || b == 0xDE || b == 0xDF) ? Codec::MsgPack : Codec::Json;
+}
+
+inline DeserializationError decodeMessage(JsonDocument& doc, const uint8_t* p, size_t n, Codec c) {
+  if (c == Codec::MsgPack) return deserializeMsgPack(doc, p, n);
+  return deserializeJson(doc, p, n);
+}
+
+// std::string rather than String: MessagePack output may contain NUL bytes.
+inline std::string encodeMessage(const JsonDocument& doc, Codec c) {
+  std::string out;
+  if (c == Codec::MsgPack) serializeMsgPack(doc, out);
+  else serializeJson(doc, out);
+  return out;
+}
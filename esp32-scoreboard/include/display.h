@@ -1,15 +1,62 @@
 #pragma once
 #include <Arduino.h>
+#include "gesture.h"
+#ifdef HOT_PATH_BENCH
+#include "bench.h"
+#endif
 
 // Very lightweight rendering hook. By default we just log to Serial.
 // If you want on-device graphics, define USE_TFT_ESPI in platformio.ini
 // and provide a configured TFT_eSPI setup for your ST7789 display.
 
+// "#RRGGBB" as RGB565.
+constexpr uint16_t rgb565(uint32_t rgb) {
+  return (uint16_t)((((rgb >> 16) & 0xF8) << 8) | (((rgb >> 8) & 0xFC) << 3) | ((rgb & 0xFF) >> 3));
+}
+
+// Parse "#RRGGBB" or "RRGGBB" into RGB565. Returns false (and leaves *out alone) on parse error.
+inline bool parseHexColor(const char* hex, uint16_t* out) {
+  auto isHex = [](char c){ return (c>='0'&&c<='9')||(c>='a'&&c<='f')||(c>='A'&&c<='F'); };
+  if (!hex) return false;
+  if (hex[0] == '#') hex++;
+  for (int k=0; k<6; ++k) if (!isHex(hex[k])) return false;
+  if (hex[6] != 0) return false;
+  *out = rgb565(strtoul(hex, nullptr, 16));
+  return true;
+}
+
+// Copy at most N-1 bytes of src into dst without splitting a UTF-8 sequence;
+// always NUL-terminated, never allocates.
+template <size_t N>
+inline void setText(char (&dst)[N], const char* src) {
+  size_t n = 0;
+  if (src) {
+    n = strnlen(src, N - 1);
+    if (n == N - 1 && src[n] != 0) {
+      while (n > 0 && (((uint8_t)src[n]) & 0xC0) == 0x80) n--;  // back off to a lead byte
+    }
+    memcpy(dst, src, n);
+  }
+  dst[n] = 0;
+}
+
+// Fixed-capacity scoreboard state. Every string lives in a char buffer sized
+// for its longest accepted value and colors are decoded to RGB565 when they
+// are applied, so updates, copies and renders never touch the heap.
 struct ScoreboardState {
-  String ta = "Team A";
-  String tb = "Team B";
-  String ca = "#42a5f5";
-  String cb = "#ef5350";
+  static constexpr size_t kNameLen = 20;
+  static constexpr size_t kPlayerLen = 3;   // jersey number
+  static constexpr size_t kReasonLen = 31;
+  struct Color {
+    char hex[8];       // "#rrggbb"
+    uint16_t rgb565;
+    bool operator==(const Color& o) const { return rgb565 == o.rgb565 && strcmp(hex, o.hex) == 0; }
+    bool operator!=(const Color& o) const { return !(*this == o); }
+  };
+  char ta[kNameLen + 1] = "Team A";
+  char tb[kNameLen + 1] = "Team B";
+  Color ca = { "#42a5f5", rgb565(0x42a5f5) };
+  Color cb = { "#ef5350", rgb565(0xef5350) };
   int a = 0;
   int b = 0;
   char sv = 'A'; // 'A' or 'B'
@@ -17,60 +64,151 @@ struct ScoreboardState {
   int ma = 0;
   int mb = 0;
   int bo = 3;
-  bool ble = false; // BLE connected status
+  uint8_t ble = 0;  // connected BLE centrals
   // Extended styling and rotations
-  String abg = "#0c1220"; // team A panel background
-  String bbg = "#0c1220"; // team B panel background
-  String ra[6];
-  String rb[6];
+  Color abg = { "#0c1220", rgb565(0x0c1220) }; // team A panel background
+  Color bbg = { "#0c1220", rgb565(0x0c1220) }; // team B panel background
+  char ra[6][kPlayerLen + 1] = {};
+  char rb[6][kPlayerLen + 1] = {};
   uint8_t rsa = 0; // current server slot 0..5
   uint8_t rsb = 0; // current server slot 0..5
-  struct LogEntry { String reason; String scorer; uint32_t ts = 0; };
-  LogEntry la[4]; uint8_t laCount = 0; // last 4 for Team A
-  LogEntry lb[4]; uint8_t lbCount = 0; // last 4 for Team B
+  struct LogEntry {
+    char reason[kReasonLen + 1];
+    char scorer[kPlayerLen + 1];
+    uint64_t ts; // controller epoch ms
+    bool operator==(const LogEntry& o) const {
+      return ts == o.ts && strcmp(reason, o.reason) == 0 && strcmp(scorer, o.scorer) == 0;
+    }
+    bool operator!=(const LogEntry& o) const { return !(*this == o); }
+  };
+  LogEntry la[4] = {}; uint8_t laCount = 0; // last 4 for Team A
+  LogEntry lb[4] = {}; uint8_t lbCount = 0; // last 4 for Team B
 };
 
+// Validate and store a color; the RGB565 value is decoded once, here.
+inline bool setColor(ScoreboardState::Color& c, const char* hex) {
+  uint16_t v;
+  if (!parseHexColor(hex, &v)) return false;
+  c.hex[0] = '#';
+  memcpy(c.hex + 1, hex[0] == '#' ? hex + 1 : hex, 6);
+  c.hex[7] = 0;
+  c.rgb565 = v;
+  return true;
+}
+
 class DisplayRenderer {
 public:
   virtual ~DisplayRenderer() {}
   virtual void begin() {}
   virtual void loop() {}
+  // Called from loop() for every recognised touch gesture, after the renderer
+  // has handled the ones that change its view.
+  void setGestureHandler(void (*handler)(gesture::Kind)) { gestureHandler = handler; }
   virtual void render(const ScoreboardState& s) {
     Serial.printf("[DISPLAY] %s(%d) %s(%d) • serve:%c • set:%d • match:%d-%d • best:%d\n",
-      s.ta.c_str(), s.a, s.tb.c_str(), s.b, s.sv, s.set, s.ma, s.mb, s.bo);
+      s.ta, s.a, s.tb, s.b, s.sv, s.set, s.ma, s.mb, s.bo);
   }
+#ifdef HOT_PATH_BENCH
+  // Time this renderer's repaints of `s`; called once from setup().
+  virtual void benchRender(const ScoreboardState&) {}
+#endif
+protected:
+  void (*gestureHandler)(gesture::Kind) = nullptr;
 };
 
 #ifdef USE_TFT_ESPI
   #include <TFT_eSPI.h>
   #include <WiFi.h>
-  #include <qrcode.h>
-  // Convert "#RRGGBB" or "RRGGBB" to RGB565. Falls back to white on parse error.
-  inline uint16_t hexTo565(const String& hex) {
-    auto isHex = [](char c){ return (c>='0'&&c<='9')||(c>='a'&&c<='f')||(c>='A'&&c<='F'); };
-    int i = 0;
-    if (hex.length() >= 1 && (hex[0]=='#')) i = 1;
-    if (hex.length() - i < 6) return 0xFFFF;
-    char buf[7];
-    for (int k=0; k<6; ++k) {
-      char c = hex[i+k];
-      if (!isHex(c)) return 0xFFFF;
-      buf[k] = c;
-    }
-    buf[6] = 0;
-    uint32_t rgb = strtoul(buf, nullptr, 16);
-    uint8_t r = (rgb >> 16) & 0xFF;
-    uint8_t g = (rgb >> 8) & 0xFF;
-    uint8_t b = (rgb) & 0xFF;
-    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
-  }
+  #include "qr_cache.h"
+  #include "digits_font.h"
+  // Pixels pushed to the panel. Every pixel is 16-bit RGB565 on the wire.
+  // Frame times cover composition plus transfer, per rendering mode.
+  struct RenderStats {
+    uint32_t frames = 0;
+    uint32_t fullFrames = 0;
+    uint32_t lastPixels = 0;
+    uint64_t totalPixels = 0;
+    uint32_t lastFrameUs = 0;
+    uint32_t maxFrameUs = 0;
+    uint64_t totalFrameUs = 0;
+    uint32_t lastBytes() const { return lastPixels * 2; }
+    uint32_t avgFrameUs() const { return frames ? (uint32_t)(totalFrameUs / frames) : 0; }
+  };
+
   class TftRenderer : public DisplayRenderer {
     TFT_eSPI tft;
     bool showQR = false;
-    bool touchPrev = false;
-    uint32_t lastToggleMs = 0;
+    // QR codes are encoded once; the QR view is only repainted when its layout
+    // (BLE connected or not) or the station IP in its footer changes.
+    QrMatrix qrController;
+    QrMatrix qrWifi;
+    bool qrOnScreen = false;
+    bool qrShownBle = false;
+    uint32_t qrShownIp = 0;
+    // Touch. The XPT2046 pulls TOUCH_IRQ low while pressed; the ISR only sets
+    // touchIrq. The controller is read over SPI from a press until release,
+    // every kTouchSampleMs, and the bus is the display's the rest of the time.
+    static constexpr uint32_t kTouchSampleMs = 20;
+    gesture::Recognizer gestures;
+    volatile bool touchIrq = false;
+    bool touching = false;
+    uint8_t touchMisses = 0;
+    uint32_t lastTouchMs = 0;
     ScoreboardState lastState;
+    // What is currently on the panel. Only meaningful while drawnValid is set;
+    // anything that paints outside the widget grid (QR view, init) clears it.
+    ScoreboardState drawnState;
+    bool drawnValid = false;
+    uint32_t framePx = 0;
+    RenderStats stats_;
+    // Frame statistics go to the serial log as one summary per kStatsLogMs
+    // (-D DISPLAY_LOG_FRAMES adds a line per frame).
+    static constexpr uint32_t kStatsLogMs = 5000;
+    RenderStats logged_;        // stats_ at the last summary
+    uint32_t loggedMs_ = 0;
+    uint32_t windowMaxUs_ = 0;  // slowest frame since the last summary
+    // Current draw target. Widgets paint in screen coordinates; when composing
+    // into a band sprite, gfx points at the sprite and oy is the band's top row.
+    TFT_eSPI* gfx = &tft;
+    int oy = 0;
+#ifdef USE_TFT_SPRITE
+    // Full-width bands, double buffered: one is composed while the other is
+    // still streaming out over DMA. Two 320x40 16-bit bands take ~51 KB, a
+    // whole frame (150 KB) does not fit in internal RAM.
+    static constexpr int kBandH = 40;
+    TFT_eSprite band[2] = { TFT_eSprite(&tft), TFT_eSprite(&tft) };
+    uint16_t* bandBuf[2] = { nullptr, nullptr };
+    bool bandsReady = false;
+#endif
+
+    // Scoreboard geometry, derived once from the panel size.
+    struct Layout {
+      int W, H, colW, colAX, colBX;
+      int nameH, scoreY, statsY, triY, rotTop, logsTop, footY;
+      int cw, ch;
+    };
+    struct Palette { uint16_t colA, colB, bgA, bgB; };
+    static constexpr int kPad = 10;
+    static constexpr int kTopY = 4;
+    static constexpr int kGapX = 6;
+    static constexpr int kGapY = 2;
+    static constexpr int kLogLineH = 9;
+    static constexpr int kFootSize = 1;
+
+    // Widget ids. Each team has kTeamWidgets slots (name, serve, score, stats,
+    // six rotation cells, four log lines); the shared footer comes last.
+    enum : int { W_NAME, W_SERVE, W_SCORE, W_STATS, W_ROT0, W_LOG0 = W_ROT0 + 6, kTeamWidgets = W_LOG0 + 4 };
+    static constexpr int W_FOOTER = 2 * kTeamWidgets;
+    static constexpr int kWidgets = W_FOOTER + 1;
+    static constexpr uint32_t kAllWidgets = (1u << kWidgets) - 1;
+    static uint32_t bit(bool isA, int w) { return 1u << ((isA ? 0 : kTeamWidgets) + w); }
   public:
+    const RenderStats& stats() const { return stats_; }
+#ifdef HOST_BUILD
+    TFT_eSPI& panel() { return tft; }  // the host simulator inspects the framebuffer
+    bool showingQr() const { return showQR; }
+#endif
+
     void begin() override {
       Serial.println("[DISPLAY] Using TFT_eSPI renderer");
 #ifdef TFT_BL
@@ -83,6 +221,10 @@ public:
 #endif
       tft.init();
       tft.setRotation(1); // adjust as needed
+#ifdef TOUCH_IRQ
+      pinMode(TOUCH_IRQ, INPUT);  // input-only pin, pulled up on the board
+      attachInterruptArg(digitalPinToInterrupt(TOUCH_IRQ), onTouchIrq, this, FALLING);
+#endif
       // Quick test pattern to verify panel output
       tft.fillScreen(TFT_RED);   delay(150);
       tft.fillScreen(TFT_GREEN); delay(150);
@@ -93,219 +235,538 @@ public:
       tft.setTextColor(TFT_WHITE, TFT_BLACK);
       tft.setCursor(6, 6);
       tft.print("TFT init OK");
+#ifdef USE_TFT_SPRITE
+      bandsReady = true;
+      for (int i = 0; i < 2; i++) {
+        band[i].setColorDepth(16);
+        bandBuf[i] = (uint16_t*)band[i].createSprite(tft.width(), kBandH);
+        if (!bandBuf[i]) bandsReady = false;
+        band[i].setTextFont(1);
+      }
+      if (bandsReady) bandsReady = tft.initDMA();
+      if (!bandsReady) {
+        for (int i = 0; i < 2; i++) band[i].deleteSprite();
+        Serial.println("[DISPLAY] Sprite bands unavailable, drawing direct");
+      } else {
+        Serial.printf("[DISPLAY] Sprite bands %dx%d x2, DMA push\n", tft.width(), kBandH);
+      }
+#endif
+#ifdef DIGITS_BENCH
+      benchScore();
+#endif
+      drawnValid = false;
       delay(500);
     }
     void loop() override {
-      uint16_t tx, ty;
-      bool pressed = tft.getTouch(&tx, &ty);
       uint32_t now = millis();
-      if (pressed && !touchPrev && (now - lastToggleMs > 400)) {
-        showQR = !showQR;
-        lastToggleMs = now;
-        if (showQR) drawQR(lastState); else drawScoreboard(lastState);
+      logStats(now);
+      if (!touching) {
+#ifdef TOUCH_IRQ
+        if (!touchIrq) return;  // nobody touching: no SPI at all
+        touchIrq = false;
+        if (digitalRead(TOUCH_IRQ) != LOW) return;  // a bounce, already lifted
+#else
+        if (now - lastTouchMs < kTouchSampleMs) return;  // no IRQ line: poll, but slowly
+#endif
+      } else if (now - lastTouchMs < kTouchSampleMs) {
+        return;
       }
-      touchPrev = pressed;
+      lastTouchMs = now;
+      uint16_t tx = 0, ty = 0;
+      bool pressed = tft.getTouch(&tx, &ty);
+      bool down = pressed;
+#ifdef TOUCH_IRQ
+      down = down || digitalRead(TOUCH_IRQ) == LOW;  // contact too light for a position
+#endif
+      if (down) touchMisses = 0;
+      else if (touching && ++touchMisses < 2) return;  // one empty sample is not a release
+      touching = down;
+#ifdef TOUCH_IRQ
+      if (!touching) touchIrq = false;  // edges from the conversions just made
+#endif
+      gesture::Kind g = pressed ? gestures.press(tx, ty, now) : down ? gestures.hold(now) : gestures.release(now);
+      if (g != gesture::None) onGesture(g);
     }
 
     void render(const ScoreboardState& s) override {
-      Serial.println("[DISPLAY] render() called");
       lastState = s;
-      if (showQR) drawQR(lastState); else drawScoreboard(lastState);
+      if (showQR && qrOnScreen && (s.ble > 0) == qrShownBle && (uint32_t)WiFi.localIP() == qrShownIp) return;
+      paint();
+    }
+
+#ifdef HOT_PATH_BENCH
+    // A full repaint and a one-point score repaint, as the display sink would
+    // ask for them, outside the frame statistics.
+    void benchRender(const ScoreboardState& s) override {
+      bench::run("drawScoreboard full", 20, [&] { drawnValid = false; drawScoreboard(s); });
+      ScoreboardState next = s;
+      bench::run("drawScoreboard score-only", 50, [&] { next.a = (next.a + 1) % 100; drawScoreboard(next); });
+      drawnValid = false;  // the first real frame repaints everything
+    }
+#endif
+
+    // Call when the SoftAP credentials or controller origin change.
+    void invalidateQr() {
+      qrController.invalidate();
+      qrWifi.invalidate();
+      qrOnScreen = false;
     }
 
   private:
-    void drawScoreboard(const ScoreboardState& s) {
-      tft.fillScreen(TFT_BLACK);
-      tft.setTextFont(1);
-      uint16_t colA = hexTo565(s.ca);
-      uint16_t colB = hexTo565(s.cb);
-      uint16_t bgA = hexTo565(s.abg);
-      uint16_t bgB = hexTo565(s.bbg);
-      const int W = tft.width();
-      const int H = tft.height();
-      const int pad = 10;
-      const int colW = (W - pad * 3) / 2;
-      const int colAX = pad;
-      const int colBX = pad * 2 + colW;
-      const int topY = 8;
-      // Panel backgrounds
-      tft.fillRoundRect(colAX - 2, 2, colW + 4, H - 30, 8, bgA);
-      tft.fillRoundRect(colBX - 2, 2, colW + 4, H - 30, 8, bgB);
-      auto calcWidth = [](const String& txt, int size){ return (int)(txt.length() * 6 * size); };
-      tft.setTextSize(2);
-      tft.setTextColor(TFT_WHITE, bgA);
-      int nameH = 8 * 2;
-      int aNameW = calcWidth(s.ta, 2);
-      int aNameX = colAX + (colW - aNameW) / 2;
-      tft.setCursor(aNameX, topY);
-      tft.print(s.ta);
-      int bNameW = calcWidth(s.tb, 2);
-      int bNameX = colBX + (colW - bNameW) / 2;
-      tft.setTextColor(TFT_WHITE, bgB);
-      tft.setCursor(bNameX, topY);
-      tft.print(s.tb);
-      int siY = topY + nameH / 2;
-      tft.fillCircle((s.sv=='A'||s.sv=='a') ? (colAX+4) : (colBX+4), siY, 3, TFT_YELLOW);
-      const int scoreSize = 5;
-      const int scoreY = topY + nameH + 8;
-      tft.setTextSize(scoreSize);
-      String aScore = String(s.a < 100 ? (s.a < 10 ? "0" : "") : "") + String(s.a);
-      int aScoreW = calcWidth(aScore, scoreSize);
-      int aScoreX = colAX + (colW - aScoreW) / 2;
-      tft.setTextColor(colA, bgA);
-      tft.setCursor(aScoreX, scoreY);
-      tft.print(aScore);
-      String bScore = String(s.b < 100 ? (s.b < 10 ? "0" : "") : "") + String(s.b);
-      int bScoreW = calcWidth(bScore, scoreSize);
-      int bScoreX = colBX + (colW - bScoreW) / 2;
-      tft.setTextColor(colB, bgB);
-      tft.setCursor(bScoreX, scoreY);
-      tft.print(bScore);
-      tft.setTextSize(2);
-      tft.setTextColor(TFT_WHITE, bgA);
-      int statsY = scoreY + (8 * scoreSize) + 6;
-      String at = String("Set ") + String(s.set) + String("  W:") + String(s.ma);
-      int atW = calcWidth(at, 2);
-      int atX = colAX + (colW - atW) / 2;
-      tft.setCursor(atX, statsY);
-      tft.print(at);
-      tft.setTextColor(TFT_WHITE, bgB);
-      String bt = String("Set ") + String(s.set) + String("  W:") + String(s.mb);
-      int btW = calcWidth(bt, 2);
-      int btX = colBX + (colW - btW) / 2;
-      tft.setCursor(btX, statsY);
-      tft.print(bt);
-
-      // Serving indicators (small triangle at top of serving column)
-      uint16_t serveCol = TFT_YELLOW;
-      int triY = topY + nameH + 6;
-      if (s.sv == 'A') {
-        tft.fillTriangle(colAX + 6, triY, colAX + 26, triY, colAX + 16, triY + 12, serveCol);
-      } else {
-        tft.fillTriangle(colBX + colW - 26, triY, colBX + colW - 6, triY, colBX + colW - 16, triY + 12, serveCol);
+#ifdef TOUCH_IRQ
+    static void IRAM_ATTR onTouchIrq(void* self) { static_cast<TftRenderer*>(self)->touchIrq = true; }
+#endif
+
+    // Tap and horizontal swipes flip between the scoreboard and the QR view;
+    // everything goes on to the firmware's handler (long-press clears the set).
+    void onGesture(gesture::Kind g) {
+      Serial.printf("[TOUCH] %s\n", gesture::name(g));
+      if (g == gesture::Tap || g == gesture::SwipeLeft || g == gesture::SwipeRight) {
+        showQR = !showQR;
+        drawnValid = false;
+        qrOnScreen = false;
+        paint();
       }
+      if (gestureHandler) gestureHandler(g);
+    }
 
-      // Rotations: draw 2x3 grid per team, inner divider as the net.
-      // Left team: position #1 at lower-left; count upward counter-clockwise (around perimeter).
-      // Right team: position #1 at upper-right; count clockwise (around perimeter).
-      const int gapX = 6;
-      const int gapY = 6;
-      const int cw = (colW - 20 - gapX) / 2; // two columns
-      const int ch = 24;                      // three rows
-      auto drawRotation = [&](int x, int y, const String rs[6], uint8_t cur, uint16_t bg, bool isLeft){
-        tft.setTextSize(2);
-        tft.setTextColor(TFT_WHITE, bg);
-        // Mapping from rotation index (0..5) to (col,row)
-        // Left side (isLeft=true): 1(lower-left)->2(mid-left)->3(top-left)->4(top-right)->5(mid-right)->6(lower-right)
-        // Right side (isLeft=false): 1(upper-right)->2(mid-right)->3(lower-right)->4(lower-left)->5(mid-left)->6(upper-left)
-        auto mapIndex = [&](int i, int &c, int &r){
-          if (isLeft) {
-            switch (i) { // CCW from bottom-left
-              case 0: c=0; r=2; break; // #1
-              case 1: c=0; r=1; break; // #2
-              case 2: c=0; r=0; break; // #3
-              case 3: c=1; r=0; break; // #4
-              case 4: c=1; r=1; break; // #5
-              default: c=1; r=2; break; // #6
-            }
-          } else {
-            switch (i) { // CW from top-right
-              case 0: c=1; r=0; break; // #1
-              case 1: c=1; r=1; break; // #2
-              case 2: c=1; r=2; break; // #3
-              case 3: c=0; r=2; break; // #4
-              case 4: c=0; r=1; break; // #5
-              default: c=0; r=0; break; // #6
-            }
+#ifdef DIGITS_BENCH
+    // Boot-time comparison of one score repaint, straight to the panel: the
+    // 6x8 GLCD font scaled to the glyph height against the pre-rendered glyphs.
+    void benchScore() {
+      const Layout L = layout();
+      ScoreboardState s;
+      const int kRuns = 50;
+      const int size = digits::kHeight / 8;
+      char txt[4];
+      uint32_t t0 = micros();
+      for (int i = 0; i < kRuns; i++) {
+        snprintf(txt, sizeof(txt), "%02d", i);
+        text(L.colAX + (L.colW - textWidth(txt, size)) / 2, L.scoreY, txt, size, TFT_WHITE, TFT_BLACK);
+      }
+      uint32_t textUs = (micros() - t0) / kRuns;
+      t0 = micros();
+      for (int i = 0; i < kRuns; i++) {
+        s.a = i;
+        drawScore(L, s, true, TFT_WHITE, TFT_BLACK);
+      }
+      uint32_t glyphUs = (micros() - t0) / kRuns;
+      Serial.printf("[DISPLAY] score repaint: scaled text %lu us, glyphs %lu us\n",
+        (unsigned long)textUs, (unsigned long)glyphUs);
+    }
+#endif
+
+    const char* modeName() const {
+#ifdef USE_TFT_SPRITE
+      if (bandsReady && !showQR) return "sprite+dma";
+#endif
+      return "direct";
+    }
+
+    void paint() {
+      framePx = 0;
+      bool full = showQR || !drawnValid;
+      uint32_t t0 = micros();
+      if (showQR) drawQR(lastState); else drawScoreboard(lastState);
+      uint32_t us = micros() - t0;
+      stats_.frames++;
+      if (full) stats_.fullFrames++;
+      stats_.lastPixels = framePx;
+      stats_.totalPixels += framePx;
+      stats_.lastFrameUs = us;
+      stats_.totalFrameUs += us;
+      if (us > stats_.maxFrameUs) stats_.maxFrameUs = us;
+      if (us > windowMaxUs_) windowMaxUs_ = us;
+#ifdef DISPLAY_LOG_FRAMES
+      const uint32_t screenPx = (uint32_t)tft.width() * tft.height();
+      Serial.printf("[DISPLAY] %s render (%s): %lu px (%lu B), %.1f%% of frame, %lu us (avg %lu, max %lu)\n",
+        full ? "full" : "partial", modeName(), (unsigned long)framePx,
+        (unsigned long)stats_.lastBytes(), 100.0f * framePx / screenPx, (unsigned long)us,
+        (unsigned long)stats_.avgFrameUs(), (unsigned long)stats_.maxFrameUs);
+#endif
+    }
+
+    // One line for the frames drawn since the last summary, if there were any.
+    void logStats(uint32_t now) {
+      if (now - loggedMs_ < kStatsLogMs) return;
+      uint32_t frames = stats_.frames - logged_.frames;
+      if (frames) {
+        uint64_t px = stats_.totalPixels - logged_.totalPixels;
+        uint64_t us = stats_.totalFrameUs - logged_.totalFrameUs;
+        const uint32_t screenPx = (uint32_t)tft.width() * tft.height();
+        Serial.printf("[DISPLAY] %lu frames (%lu full) in %lu ms, %s: avg %lu px (%.1f%% of frame), %lu us, max %lu us\n",
+          (unsigned long)frames, (unsigned long)(stats_.fullFrames - logged_.fullFrames),
+          (unsigned long)(now - loggedMs_), modeName(), (unsigned long)(px / frames),
+          100.0f * (px / frames) / screenPx, (unsigned long)(us / frames), (unsigned long)windowMaxUs_);
+      }
+      logged_ = stats_;
+      loggedMs_ = now;
+      windowMaxUs_ = 0;
+    }
+
+    // ---- Counted drawing primitives ----
+    // Pixels are only counted when they go straight to the panel; band
+    // composition is counted once per pushed band instead.
+    bool direct() const { return gfx == &tft; }
+    static int textWidth(const char* txt, int size) { return (int)(strlen(txt) * 6 * size); }
+    void fill(int x, int y, int w, int h, uint16_t c) {
+      gfx->fillRect(x, y - oy, w, h, c);
+      if (direct()) framePx += (uint32_t)w * h;
+    }
+    // Native-order RGB565. TFT_eSPI::pushImage is not virtual, so a band
+    // sprite has to be called as one; the panel wants the bytes swapped, the
+    // sprite swaps them itself.
+    void pushImage(int x, int y, int w, int h, uint16_t* data) {
+#ifdef USE_TFT_SPRITE
+      if (!direct()) {
+        static_cast<TFT_eSprite*>(gfx)->pushImage(x, y - oy, w, h, data);
+        return;
+      }
+#endif
+      tft.setSwapBytes(true);
+      tft.pushImage(x, y, w, h, data);
+      tft.setSwapBytes(false);
+      framePx += (uint32_t)w * h;
+    }
+    void text(int x, int y, const char* txt, int size, uint16_t fg, uint16_t bg) {
+      gfx->setTextSize(size);
+      gfx->setTextColor(fg, bg);
+      gfx->setCursor(x, y - oy);
+      gfx->print(txt);
+      if (direct()) framePx += (uint32_t)textWidth(txt, size) * 8 * size;
+    }
+    // Clip to at most maxW pixels so text never spills into the neighbouring column.
+    template <size_t N>
+    static const char* fitText(char (&buf)[N], const char* txt, int size, int maxW) {
+      size_t maxChars = (size_t)(maxW / (6 * size));
+      if (maxChars > N - 1) maxChars = N - 1;
+      size_t n = strnlen(txt, maxChars);
+      memcpy(buf, txt, n);
+      buf[n] = 0;
+      return buf;
+    }
+
+    Layout layout() {
+      Layout L;
+      L.W = tft.width();
+      L.H = tft.height();
+      L.colW = (L.W - kPad * 3) / 2;
+      L.colAX = kPad;
+      L.colBX = kPad * 2 + L.colW;
+      // Top to bottom on a 240-row panel: name 16, score 90 (the digit
+      // height), stats 16, rotation grid 58, four log lines, footer 8.
+      L.nameH = 8 * 2;
+      L.scoreY = kTopY + L.nameH + 2;
+      L.triY = L.scoreY;  // in the score row's outer corner, beside the digits
+      L.statsY = L.scoreY + digits::kHeight + 2;
+      L.cw = (L.colW - 20 - kGapX) / 2; // two columns
+      L.ch = 18;                         // three rows, size-2 text with a 1 px frame
+      L.rotTop = L.statsY + 16 + 3;
+      L.logsTop = L.rotTop + 3 * L.ch + 2 * kGapY + 2;
+      L.footY = L.H - 8 * kFootSize;
+      return L;
+    }
+
+    // ---- Widgets. Each one owns a fixed rectangle and repaints it completely. ----
+    void drawPanel(const Layout& L, bool isA, uint16_t bg) {
+      int x = isA ? L.colAX : L.colBX;
+      gfx->fillRoundRect(x - 2, 2 - oy, L.colW + 4, L.footY - 4, 8, bg);
+      if (direct()) framePx += (uint32_t)(L.colW + 4) * (L.footY - 4);
+    }
+
+    void drawName(const Layout& L, const ScoreboardState& s, bool isA, uint16_t bg) {
+      int x = isA ? L.colAX : L.colBX;
+      char buf[ScoreboardState::kNameLen + 1];
+      const char* name = fitText(buf, isA ? s.ta : s.tb, 2, L.colW);
+      fill(x, kTopY, L.colW, L.nameH, bg);
+      text(x + (L.colW - textWidth(name, 2)) / 2, kTopY, name, 2, TFT_WHITE, bg);
+      bool serving = isA ? (s.sv=='A'||s.sv=='a') : !(s.sv=='A'||s.sv=='a');
+      if (serving) {
+        gfx->fillCircle(x + 4, kTopY + L.nameH / 2 - oy, 3, TFT_YELLOW);
+        if (direct()) framePx += 7 * 7;
+      }
+    }
+
+    // Serving indicator (small triangle at top of serving column)
+    void drawServe(const Layout& L, const ScoreboardState& s, bool isA, uint16_t bg) {
+      int x0 = isA ? L.colAX + 6 : L.colBX + L.colW - 26;
+      fill(x0, L.triY, 21, 13, bg);
+      bool serving = isA ? (s.sv == 'A') : (s.sv != 'A');
+      if (serving) {
+        int y = L.triY - oy;
+        gfx->fillTriangle(x0, y, x0 + 20, y, x0 + 10, y + 12, TFT_YELLOW);
+        if (direct()) framePx += 21 * 13 / 2;
+      }
+    }
+
+    // Scores are two anti-aliased digits from digits_font.h. Both are blended
+    // into one buffer through a 16-entry colour table and pushed as a single
+    // image, which also covers the previous value, so there is no separate
+    // erase and no per-pixel rectangles as with scaled GLCD text.
+    static constexpr int kScoreW = 2 * digits::kWidth + digits::kGap;
+    uint16_t scoreBuf[kScoreW * digits::kHeight];
+
+    static uint16_t blend565(uint16_t fg, uint16_t bg, int a) {
+      int r = ((bg >> 11) * (15 - a) + (fg >> 11) * a + 7) / 15;
+      int g = (((bg >> 5) & 0x3F) * (15 - a) + ((fg >> 5) & 0x3F) * a + 7) / 15;
+      int b = ((bg & 0x1F) * (15 - a) + (fg & 0x1F) * a + 7) / 15;
+      return (uint16_t)((r << 11) | (g << 5) | b);
+    }
+
+    void drawScore(const Layout& L, const ScoreboardState& s, bool isA, uint16_t fg, uint16_t bg) {
+      int x = isA ? L.colAX : L.colBX;
+      int v = isA ? s.a : s.b;
+      uint16_t lut[16];
+      for (int a = 0; a < 16; a++) lut[a] = blend565(fg, bg, a);
+      const int d[2] = { (v / 10) % 10, v % 10 };
+      for (int y = 0; y < digits::kHeight; y++) {
+        uint16_t* out = scoreBuf + y * kScoreW;
+        for (int i = 0; i < 2; i++) {
+          const uint8_t* row = digits::kGlyphs[d[i]] + y * digits::kRowBytes;
+          for (int px = 0; px < digits::kWidth; px += 2) {
+            uint8_t pair = pgm_read_byte(row + px / 2);
+            *out++ = lut[pair >> 4];
+            if (px + 1 < digits::kWidth) *out++ = lut[pair & 0x0F];
           }
-        };
-        for (int i=0;i<6;i++) {
-          int c, r; mapIndex(i, c, r);
-          int gx = x + c * (cw + gapX);
-          int gy = y + r * (ch + gapY);
-          uint16_t frame = (i == (int)cur) ? TFT_YELLOW : TFT_DARKGREY;
-          tft.drawRoundRect(gx, gy, cw, ch, 4, frame);
-          String txt = rs[i];
-          int tw = calcWidth(txt, 2);
-          int tx = gx + (cw - tw) / 2;
-          int ty = gy + 4;
-          tft.setCursor(tx, ty);
-          tft.print(txt);
+          if (i == 0) for (int g = 0; g < digits::kGap; g++) *out++ = lut[0];
+        }
+      }
+      pushImage(x + (L.colW - kScoreW) / 2, L.scoreY, kScoreW, digits::kHeight, scoreBuf);
+    }
+
+    void drawStats(const Layout& L, const ScoreboardState& s, bool isA, uint16_t bg) {
+      int x = isA ? L.colAX : L.colBX;
+      char st[24];
+      snprintf(st, sizeof(st), "Set %d  W:%d", s.set, isA ? s.ma : s.mb);
+      fill(x, L.statsY, L.colW, 16, bg);
+      text(x + (L.colW - textWidth(st, 2)) / 2, L.statsY, st, 2, TFT_WHITE, bg);
+    }
+
+    // Rotations: 2x3 grid per team, inner divider as the net.
+    // Left team: position #1 at lower-left; count upward counter-clockwise (around perimeter).
+    // Right team: position #1 at upper-right; count clockwise (around perimeter).
+    // Left side (isLeft=true): 1(lower-left)->2(mid-left)->3(top-left)->4(top-right)->5(mid-right)->6(lower-right)
+    // Right side (isLeft=false): 1(upper-right)->2(mid-right)->3(lower-right)->4(lower-left)->5(mid-left)->6(upper-left)
+    static void rotationCell(int i, bool isLeft, int &c, int &r) {
+      if (isLeft) {
+        switch (i) { // CCW from bottom-left
+          case 0: c=0; r=2; break; // #1
+          case 1: c=0; r=1; break; // #2
+          case 2: c=0; r=0; break; // #3
+          case 3: c=1; r=0; break; // #4
+          case 4: c=1; r=1; break; // #5
+          default: c=1; r=2; break; // #6
+        }
+      } else {
+        switch (i) { // CW from top-right
+          case 0: c=1; r=0; break; // #1
+          case 1: c=1; r=1; break; // #2
+          case 2: c=1; r=2; break; // #3
+          case 3: c=0; r=2; break; // #4
+          case 4: c=0; r=1; break; // #5
+          default: c=0; r=0; break; // #6
+        }
+      }
+    }
+
+    void drawRotationSlot(const Layout& L, const ScoreboardState& s, bool isA, int i, uint16_t bg) {
+      int c, r; rotationCell(i, isA, c, r);
+      int gx = (isA ? L.colAX : L.colBX) + 10 + c * (L.cw + kGapX);
+      int gy = L.rotTop + r * (L.ch + kGapY);
+      uint8_t cur = isA ? s.rsa : s.rsb;
+      uint16_t frame = (i == (int)cur) ? TFT_YELLOW : TFT_DARKGREY;
+      fill(gx, gy, L.cw, L.ch, bg);
+      gfx->drawRoundRect(gx, gy - oy, L.cw, L.ch, 4, frame);
+      if (direct()) framePx += 2 * (L.cw + L.ch);
+      char buf[ScoreboardState::kPlayerLen + 1];
+      const char* txt = fitText(buf, isA ? s.ra[i] : s.rb[i], 2, L.cw - 4);
+      text(gx + (L.cw - textWidth(txt, 2)) / 2, gy + (L.ch - 16) / 2, txt, 2, TFT_WHITE, bg);
+    }
+
+    // Draw the net between teams across the rotation area
+    void drawNet(const Layout& L) {
+      int netX = L.colAX + L.colW + (kPad / 2);
+      int netY1 = L.rotTop - 4;
+      int netY2 = L.rotTop + (3 * L.ch + 2 * kGapY) + 2;
+      for (int dy = netY1; dy <= netY2; dy += 4) {
+        gfx->drawFastVLine(netX, dy - oy, 2, TFT_LIGHTGREY);
+        if (direct()) framePx += 2;
+      }
+    }
+
+    // Logs: last 4 entries for each team, small font, near bottom of column.
+    // Line i shows entry i (oldest to newest among the kept entries) or is blank.
+    void drawLogLine(const Layout& L, const ScoreboardState& s, bool isA, int i, uint16_t bg) {
+      int x = (isA ? L.colAX : L.colBX) + 8;
+      int y = L.logsTop + i * kLogLineH;
+      fill(x, y, L.colW - 8, 8, bg);
+      uint8_t n = isA ? s.laCount : s.lbCount;
+      if (i >= n) return;
+      const auto &e = isA ? s.la[i] : s.lb[i];
+      // format HH:MM from ts (ms)
+      uint32_t sec = (uint32_t)((e.ts / 1000ULL) % 86400ULL);
+      uint32_t hh = sec / 3600UL;
+      uint32_t mm = (sec % 3600UL) / 60UL;
+      char line[48], fit[48];
+      snprintf(line, sizeof(line), "%02lu:%02lu %s%s%s", (unsigned long)hh, (unsigned long)mm,
+        e.reason, e.scorer[0] ? " #" : "", e.scorer);
+      text(x, y, fitText(fit, line, 1, L.colW - 8), 1, TFT_LIGHTGREY, bg);
+    }
+
+    void drawFooter(const Layout& L, const ScoreboardState& s) {
+      char footer[32];
+      snprintf(footer, sizeof(footer), "Match %d-%d  Bo%d", s.ma, s.mb, s.bo);
+      fill(0, L.footY, L.W, 8 * kFootSize, TFT_BLACK);
+      text((L.W - textWidth(footer, kFootSize)) / 2, L.footY, footer, kFootSize, TFT_WHITE, TFT_BLACK);
+    }
+
+    // ---- Widget table ----
+    // Vertical extent of a widget; bands are full width so rows are all we need.
+    void widgetRows(const Layout& L, int id, int& y, int& h) const {
+      if (id == W_FOOTER) { y = L.footY; h = 8 * kFootSize; return; }
+      bool isA = id < kTeamWidgets;
+      int w = isA ? id : id - kTeamWidgets;
+      if (w == W_NAME)       { y = kTopY;    h = L.nameH; }
+      else if (w == W_SERVE) { y = L.triY;   h = 13; }
+      else if (w == W_SCORE) { y = L.scoreY; h = digits::kHeight; }
+      else if (w == W_STATS) { y = L.statsY; h = 16; }
+      else if (w < W_LOG0) {
+        int c, r; rotationCell(w - W_ROT0, isA, c, r);
+        y = L.rotTop + r * (L.ch + kGapY); h = L.ch;
+      } else { y = L.logsTop + (w - W_LOG0) * kLogLineH; h = 8; }
+    }
+
+    void paintWidget(const Layout& L, const Palette& P, const ScoreboardState& s, int id) {
+      if (id == W_FOOTER) { drawFooter(L, s); return; }
+      bool isA = id < kTeamWidgets;
+      int w = isA ? id : id - kTeamWidgets;
+      uint16_t bg = isA ? P.bgA : P.bgB;
+      if (w == W_NAME)       drawName(L, s, isA, bg);
+      else if (w == W_SERVE) drawServe(L, s, isA, bg);
+      else if (w == W_SCORE) drawScore(L, s, isA, isA ? P.colA : P.colB, bg);
+      else if (w == W_STATS) drawStats(L, s, isA, bg);
+      else if (w < W_LOG0)   drawRotationSlot(L, s, isA, w - W_ROT0, bg);
+      else                   drawLogLine(L, s, isA, w - W_LOG0, bg);
+    }
+
+    // Widgets whose inputs differ from what is already on the panel.
+    uint32_t dirtyWidgets(const ScoreboardState& s) const {
+      const ScoreboardState& d = drawnState;
+      uint32_t dirty = 0;
+      bool svChanged = s.sv != d.sv;
+      for (int t = 0; t < 2; t++) {
+        bool isA = (t == 0);
+        if (svChanged || strcmp(isA ? s.ta : s.tb, isA ? d.ta : d.tb) != 0) dirty |= bit(isA, W_NAME);
+        if (svChanged) dirty |= bit(isA, W_SERVE);
+        if (isA ? (s.a != d.a || s.ca != d.ca) : (s.b != d.b || s.cb != d.cb)) dirty |= bit(isA, W_SCORE);
+        if (s.set != d.set || (isA ? s.ma != d.ma : s.mb != d.mb)) dirty |= bit(isA, W_STATS);
+        const auto& rs = isA ? s.ra : s.rb;
+        const auto& drs = isA ? d.ra : d.rb;
+        int cur = isA ? s.rsa : s.rsb;
+        int dcur = isA ? d.rsa : d.rsb;
+        for (int i = 0; i < 6; i++) {
+          if (strcmp(rs[i], drs[i]) != 0 || ((i == cur) != (i == dcur))) dirty |= bit(isA, W_ROT0 + i);
+        }
+        const ScoreboardState::LogEntry* ls = isA ? s.la : s.lb;
+        const ScoreboardState::LogEntry* dls = isA ? d.la : d.lb;
+        uint8_t n = isA ? s.laCount : s.lbCount;
+        uint8_t dn = isA ? d.laCount : d.lbCount;
+        for (int i = 0; i < 4; i++) {
+          bool had = i < dn, has = i < n;
+          if (had != has || (has && ls[i] != dls[i])) dirty |= bit(isA, W_LOG0 + i);
         }
-      };
-      int rotTop = statsY + 26;
-      drawRotation(colAX + 10, rotTop, s.ra, s.rsa, bgA, true);
-      drawRotation(colBX + 10, rotTop, s.rb, s.rsb, bgB, false);
+      }
+      if (s.ma != d.ma || s.mb != d.mb || s.bo != d.bo) dirty |= 1u << W_FOOTER;
+      return dirty;
+    }
 
-      // Draw the net between teams across the rotation area
+    // Paint the scoreboard, touching only the widgets whose inputs differ from
+    // what is already on the panel. Background changes force a full repaint.
+    void drawScoreboard(const ScoreboardState& s) {
+      const Layout L = layout();
+      const Palette P = { s.ca.rgb565, s.cb.rgb565, s.abg.rgb565, s.bbg.rgb565 };
+      bool full = !drawnValid || s.abg != drawnState.abg || s.bbg != drawnState.bbg;
+      uint32_t dirty = full ? kAllWidgets : dirtyWidgets(s);
+#ifdef USE_TFT_SPRITE
+      if (bandsReady) composeBands(L, P, s, dirty, full);
+      else
+#endif
       {
-        int netX = colAX + colW + ( (pad) / 2 );
-        int netY1 = rotTop - 4;
-        int netY2 = rotTop + (3 * ch + 2 * gapY) + 8;
-        for (int dy = netY1; dy <= netY2; dy += 4) {
-          tft.drawFastVLine(netX, dy, 2, TFT_LIGHTGREY);
+        gfx = &tft; oy = 0;
+        tft.setTextFont(1);
+        if (full) {
+          tft.fillScreen(TFT_BLACK);
+          framePx += (uint32_t)L.W * L.H;
+          drawPanel(L, true, P.bgA);
+          drawPanel(L, false, P.bgB);
+          drawNet(L);
+        }
+        for (int id = 0; id < kWidgets; id++) {
+          if (dirty & (1u << id)) paintWidget(L, P, s, id);
         }
       }
+      drawnState = s;
+      drawnValid = true;
+    }
 
-      // Logs: last 4 entries for each team, small font, near bottom of column
-      auto drawLogs = [&](int x, int y, const ScoreboardState::LogEntry* items, uint8_t n, uint16_t bg){
-        tft.setTextSize(1);
-        tft.setTextColor(TFT_LIGHTGREY, bg);
-        int lineH = 10;
-        // Draw from oldest to newest among the kept entries
-        for (int i=0; i<n; i++) {
-          const auto &e = items[i];
-          // format HH:MM from ts (ms)
-          uint32_t sec = (e.ts / 1000UL) % 86400UL;
-          uint32_t hh = sec / 3600UL;
-          uint32_t mm = (sec % 3600UL) / 60UL;
-          char when[6];
-          snprintf(when, sizeof(when), "%02lu:%02lu", (unsigned long)hh, (unsigned long)mm);
-          String line = String(when) + String(" ") + e.reason;
-          if (e.scorer.length()) line += String(" #") + e.scorer;
-          tft.setCursor(x, y + i*lineH);
-          tft.print(line);
+#ifdef USE_TFT_SPRITE
+    // Recompose every band that holds a dirty widget. A band is rebuilt from
+    // scratch (panels, net and every widget crossing it), then pushed in one
+    // DMA burst while the next band is composed into the other buffer.
+    void composeBands(const Layout& L, const Palette& P, const ScoreboardState& s, uint32_t dirty, bool full) {
+      int ys[kWidgets], hs[kWidgets];
+      for (int id = 0; id < kWidgets; id++) widgetRows(L, id, ys[id], hs[id]);
+      int sel = 0;
+      tft.startWrite();
+      for (int by = 0; by < L.H; by += kBandH) {
+        int bh = min(kBandH, L.H - by);
+        bool need = full;
+        for (int id = 0; id < kWidgets && !need; id++) {
+          need = (dirty & (1u << id)) && ys[id] < by + bh && ys[id] + hs[id] > by;
         }
-      };
-
-      int logsTop = H - 60; // leave space for footer
-      drawLogs(colAX + 8, logsTop, s.la, s.laCount, bgA);
-      drawLogs(colBX + 8, logsTop, s.lb, s.lbCount, bgB);
-      String footer = String("Match ") + String(s.ma) + String("-") + String(s.mb) + String("  Bo") + String(s.bo);
-      int fSize = 2;
-      int fW = calcWidth(footer, fSize);
-      int fX = (W - fW) / 2;
-      int fY = H - (8 * fSize) - 6;
-      tft.setTextSize(fSize);
-      tft.setTextColor(TFT_WHITE, TFT_BLACK);
-      tft.setCursor(fX, fY);
-      tft.print(footer);
-    }
-
-    void drawQrAt(int x, int y, int maxSize, const String& payload) {
-      // Pick a conservative QR version to ensure payload fits
-      const uint8_t version = 6; // 41x41 modules
-      // Allocate a buffer large enough for up to version 10 (57x57 -> ~406 bytes)
-      static uint8_t qrData[600];
-      QRCode qr;
-      qrcode_initText(&qr, qrData, version, ECC_MEDIUM, payload.c_str());
-      int size = qr.size;
-      int scale = max(1, maxSize / (size + 4)); // quiet zone of 2 modules each side
-      int qW = (size + 4) * scale;
-      tft.fillRect(x, y, qW, qW, TFT_WHITE);
-      int ox = x + 2 * scale;
-      int oy = y + 2 * scale;
-      for (int iy = 0; iy < size; iy++) {
-        for (int ix = 0; ix < size; ix++) {
-          if (qrcode_getModule(&qr, ix, iy)) {
-            tft.fillRect(ox + ix * scale, oy + iy * scale, scale, scale, TFT_BLACK);
-          }
+        if (!need) continue;
+        gfx = &band[sel]; oy = by;
+        band[sel].fillSprite(TFT_BLACK);
+        drawPanel(L, true, P.bgA);
+        drawPanel(L, false, P.bgB);
+        drawNet(L);
+        for (int id = 0; id < kWidgets; id++) {
+          if (ys[id] < by + bh && ys[id] + hs[id] > by) paintWidget(L, P, s, id);
         }
+        tft.pushImageDMA(0, by, L.W, bh, bandBuf[sel]);
+        framePx += (uint32_t)L.W * bh;
+        sel ^= 1;
+      }
+      tft.dmaWait();
+      tft.endWrite();
+      gfx = &tft; oy = 0;
+    }
+#endif
+
+    void drawQrAt(int x, int y, int maxSize, QrMatrix& qr, const String& payload) {
+      bool fresh = !qr.valid();
+      if (!qr.set(payload)) {
+        Serial.printf("[DISPLAY] QR payload too long (%u bytes)\n", (unsigned)payload.length());
+        return;
       }
+      if (fresh) Serial.printf("[DISPLAY] QR v%u (%ux%u) for %s\n", qr.version(), qr.size(), qr.size(), payload.c_str());
+      int size = qr.size();
+      int scale = max(1, maxSize / (size + 4)); // quiet zone of 2 modules each side
+      int qW = (size + 4) * scale;
+      fill(x, y, qW, qW, TFT_WHITE);
+      int qx = x + 2 * scale;
+      int qy = y + 2 * scale;
+      qr.forEachSpan([&](int mx, int my, int w, int h) {
+        fill(qx + mx * scale, qy + my * scale, w * scale, h * scale, TFT_BLACK);
+      });
     }
 
     void drawQR(const ScoreboardState& s) {
+      qrOnScreen = true;
+      qrShownBle = s.ble > 0;
+      qrShownIp = (uint32_t)WiFi.localIP();
       tft.fillScreen(TFT_BLACK);
+      framePx += (uint32_t)tft.width() * tft.height();
       tft.setTextFont(1);
       tft.setTextSize(2);
       tft.setTextColor(TFT_WHITE, TFT_BLACK);
@@ -326,7 +787,7 @@ public:
         int maxQ = min(W, H) - 2 * pad - 20;
         int qX = (W - maxQ) / 2;
         int qY = (H - maxQ) / 2;
-        drawQrAt(qX, qY, maxQ, wifi);
+        drawQrAt(qX, qY, maxQ, qrWifi, wifi);
         tft.setTextSize(2);
         tft.setTextColor(TFT_CYAN, TFT_BLACK);
         tft.setCursor(pad, H - 28);
@@ -339,12 +800,12 @@ public:
         const int colBX = pad * 2 + colW;
         const int qSize = colW;
         const int qTop = 30;
-        drawQrAt(colAX, qTop, qSize, controller);
+        drawQrAt(colAX, qTop, qSize, qrController, controller);
         tft.setTextSize(2);
         tft.setTextColor(TFT_YELLOW, TFT_BLACK);
         tft.setCursor(colAX, qTop - 22);
         tft.print("Controller (BLE)");
-        drawQrAt(colBX, qTop, qSize, wifi);
+        drawQrAt(colBX, qTop, qSize, qrWifi, wifi);
         tft.setTextColor(TFT_CYAN, TFT_BLACK);
         tft.setCursor(colBX, qTop - 22);
         tft.print("Join WiFi");
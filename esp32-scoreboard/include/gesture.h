@@ -0,0 +1,77 @@
+#pragma once
+#include <Arduino.h>
+
+// Turns touch samples into gestures. The renderer feeds it only while a finger
+// is down (see TftRenderer::loop), so it never polls on its own and holds no
+// timers: press() with each sampled position, hold() for a sample that saw
+// contact but no position, release() once the finger has lifted.
+//
+//   tap         down and up within kLongPressMs, moving at most kSlopPx
+//   long-press  held for kLongPressMs without moving; fires while still down,
+//               and the release that follows is not also a tap
+//   swipe       moved kSwipePx or more along one axis within kSwipeMs
+namespace gesture {
+
+enum Kind : uint8_t { None, Tap, LongPress, SwipeLeft, SwipeRight, SwipeUp, SwipeDown };
+
+inline const char* name(Kind k) {
+  static const char* const kNames[] = { "none", "tap", "long-press", "swipe-left", "swipe-right", "swipe-up", "swipe-down" };
+  return k <= SwipeDown ? kNames[k] : "?";
+}
+
+constexpr uint32_t kLongPressMs = 800;
+constexpr uint32_t kSwipeMs = 700;
+constexpr int kSlopPx = 20;
+constexpr int kSwipePx = 50;
+
+class Recognizer {
+public:
+  Kind press(uint16_t x, uint16_t y, uint32_t nowMs) {
+    if (!down_) {
+      down_ = true;
+      longFired_ = false;
+      x0_ = x;
+      y0_ = y;
+      t0_ = nowMs;
+      maxMove_ = 0;
+    }
+    x1_ = x;
+    y1_ = y;
+    int dx = x1_ - x0_, dy = y1_ - y0_;
+    int move = max(dx < 0 ? -dx : dx, dy < 0 ? -dy : dy);
+    if (move > maxMove_) maxMove_ = move;
+    return hold(nowMs);
+  }
+
+  Kind hold(uint32_t nowMs) {
+    if (!down_ || longFired_ || maxMove_ > kSlopPx || nowMs - t0_ < kLongPressMs) return None;
+    longFired_ = true;
+    return LongPress;
+  }
+
+  Kind release(uint32_t nowMs) {
+    if (!down_) return None;
+    down_ = false;
+    if (longFired_) return None;
+    int dx = x1_ - x0_, dy = y1_ - y0_;
+    int adx = dx < 0 ? -dx : dx, ady = dy < 0 ? -dy : dy;
+    uint32_t heldMs = nowMs - t0_;
+    if (max(adx, ady) >= kSwipePx && heldMs <= kSwipeMs) {
+      if (adx >= ady) return dx < 0 ? SwipeLeft : SwipeRight;
+      return dy < 0 ? SwipeUp : SwipeDown;
+    }
+    if (maxMove_ <= kSlopPx && heldMs < kLongPressMs) return Tap;
+    return None;  // a slow drag, or one that came back
+  }
+
+  bool down() const { return down_; }
+
+private:
+  bool down_ = false;
+  bool longFired_ = false;
+  int x0_ = 0, y0_ = 0, x1_ = 0, y1_ = 0;
+  int maxMove_ = 0;
+  uint32_t t0_ = 0;
+};
+
+} // namespace gesture
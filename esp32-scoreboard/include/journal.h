@@ -0,0 +1,254 @@
+#pragma once
+#include <Arduino.h>
+#include <LittleFS.h>
+
+// Append-only match journal on LittleFS.
+//
+// Records are staged in RAM by append() (a memcpy under a short lock) and
+// written in batches by a low-priority task, so callers never wait on flash.
+// The journal is a run of segment files, /journal/<n>.bin, each starting with
+// "VSJ1" and a Snapshot record, so any suffix of segments decodes on its own.
+// Retention is by whole segments: past kMaxSegments the oldest is deleted, and
+// nothing from it is folded into a later one, so the journal keeps the last
+// kMaxSegments segments of history and no more.
+//
+// Record: [0xA5][type][payload len][seq u32 LE][crc16 LE][payload]
+// The CRC (CCITT-FALSE) covers type, len, seq and payload. A reader stops at
+// the first bad record in a segment (a torn write) and carries on with the next.
+// A segment's snapshot may be newer than the batch written right after it;
+// readers skip records whose seq is below the snapshot's. Every boot starts a
+// new segment, and seq restarts with the device's state version.
+namespace journal {
+
+constexpr uint8_t kMagic = 0xA5;
+constexpr size_t kHeader = 9;
+constexpr size_t kMaxPayload = 255;
+constexpr size_t kSegmentBytes = 32 * 1024;
+constexpr uint32_t kMaxSegments = 24;       // retained, 768 KB: several tournament days of points
+constexpr size_t kStageBytes = 2048;        // per staging buffer (two of them)
+constexpr uint32_t kFlushMs = 2000;
+constexpr const char* kDir = "/journal";
+constexpr const char* kFileMagic = "VSJ1";
+
+// Payloads (little-endian; str = u8 length + bytes):
+//   Boot     -
+//   Snapshot score, str ta, str tb
+//   Score    u8 a, b, set, ma, mb, char sv, u8 rsa, rsb
+//   Log      char team, u64 ts, str scorer, str reason
+//   Cmd      u8 op (scoring::Op), char team, u64 ts
+//   Names    str ta, str tb
+enum Type : uint8_t { Boot = 1, Snapshot = 2, Score = 3, Log = 4, Cmd = 5, Names = 6 };
+
+inline uint16_t crc16(const uint8_t* p, size_t n, uint16_t crc = 0xFFFF) {
+  while (n--) {
+    crc ^= (uint16_t)(*p++) << 8;
+    for (int i = 0; i < 8; i++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+// One record under construction; payload writes past kMaxPayload are dropped.
+class Record {
+public:
+  Record(Type type, uint32_t seq) {
+    buf_[0] = kMagic;
+    buf_[1] = type;
+    buf_[2] = 0;
+    for (int i = 0; i < 4; i++) buf_[3 + i] = (uint8_t)(seq >> (8 * i));
+  }
+  Record& u8(uint8_t v) { if (len_ < kHeader + kMaxPayload) buf_[len_++] = v; return *this; }
+  Record& u64(uint64_t v) { for (int i = 0; i < 8; i++) u8((uint8_t)(v >> (8 * i))); return *this; }
+  Record& str(const char* s) {
+    size_t n = s ? strlen(s) : 0;
+    if (n > 64) n = 64;
+    u8((uint8_t)n);
+    for (size_t i = 0; i < n; i++) u8((uint8_t)s[i]);
+    return *this;
+  }
+  // Seal the header; returns the whole record.
+  const uint8_t* data() {
+    buf_[2] = (uint8_t)(len_ - kHeader);
+    uint16_t crc = crc16(buf_ + 1, 6);
+    crc = crc16(buf_ + kHeader, len_ - kHeader, crc);
+    buf_[7] = (uint8_t)crc;
+    buf_[8] = (uint8_t)(crc >> 8);
+    return buf_;
+  }
+  size_t size() const { return len_; }
+
+private:
+  uint8_t buf_[kHeader + kMaxPayload];
+  size_t len_ = kHeader;
+};
+
+struct Stats {
+  uint32_t records = 0;      // staged
+  uint32_t dropped = 0;      // staging buffer full
+  uint32_t flushes = 0;
+  uint32_t writeErrors = 0;
+  uint32_t bytesWritten = 0;
+  uint32_t lastFlushUs = 0;
+  uint32_t maxFlushUs = 0;
+  uint32_t retired = 0;      // segments deleted by retention since boot
+};
+
+class Journal {
+public:
+  // Builds a Snapshot record of the current state; runs on the journal task.
+  using SnapshotFn = Record (*)();
+
+  bool begin(SnapshotFn snapshot, BaseType_t core = tskNO_AFFINITY) {
+    snapshot_ = snapshot;
+    lock_ = xSemaphoreCreateMutex();
+    if (!LittleFS.begin(true)) {
+      Serial.println("[JOURNAL] LittleFS mount failed; journal disabled");
+      return false;
+    }
+    LittleFS.mkdir(kDir);
+    File dir = LittleFS.open(kDir);
+    for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+      uint32_t n = strtoul(f.name(), nullptr, 10);
+      if (!n) continue;
+      if (!oldest_ || n < oldest_) oldest_ = n;
+      if (n > newest_) newest_ = n;
+    }
+    if (!oldest_) oldest_ = 1;
+    openSegment();
+    Serial.printf("[JOURNAL] segments %u..%u, %u/%u KB used\n", (unsigned)oldest_, (unsigned)newest_,
+                  (unsigned)(LittleFS.usedBytes() / 1024), (unsigned)(LittleFS.totalBytes() / 1024));
+    xTaskCreatePinnedToCore(task, "journal", 4096, this, 1, &task_, core);
+    ready_ = true;
+    return true;
+  }
+
+  // Never blocks on flash; drops the record (and counts it) if both staging
+  // buffers are full.
+  void append(Record& r) {
+    if (!ready_) return;
+    const uint8_t* p = r.data();
+    size_t n = r.size();
+    bool kick;
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    size_t& len = stageLen_[active_];
+    if (len + n > kStageBytes) {
+      stats_.dropped++;
+      kick = true;
+    } else {
+      memcpy(stage_[active_] + len, p, n);
+      len += n;
+      stats_.records++;
+      kick = len > kStageBytes / 2;
+    }
+    xSemaphoreGive(lock_);
+    if (kick) xTaskNotifyGive(task_);
+  }
+
+  // Ask the task to write what is staged now (e.g. before an export).
+  void flushSoon() { if (ready_) xTaskNotifyGive(task_); }
+  TaskHandle_t task() const { return task_; }
+
+  uint32_t oldest() const { return oldest_; }
+  uint32_t newest() const { return newest_; }
+  Stats stats() const { return stats_; }
+
+  static void path(char* out, size_t n, uint32_t seg) { snprintf(out, n, "%s/%08u.bin", kDir, (unsigned)seg); }
+
+  // Streams every segment oldest-first, in pieces of at most `max` bytes.
+  // Each segment is opened once and read to its end across calls. Segments
+  // retired while reading are skipped.
+  class Reader {
+  public:
+    explicit Reader(const Journal& j) : j_(j), seg_(j.oldest()) {}
+    size_t read(uint8_t* buf, size_t max) {
+      while (j_.ready_ && seg_ <= j_.newest()) {
+        if (seg_ < j_.oldest()) {
+          file_.close();
+          seg_ = j_.oldest();
+        }
+        if (!file_) {
+          char name[32];
+          path(name, sizeof(name), seg_);
+          file_ = LittleFS.open(name, "r");
+        }
+        if (file_) {
+          size_t n = file_.read(buf, max);
+          if (n > 0) return n;
+          file_.close();
+        }
+        seg_++;
+      }
+      return 0;
+    }
+  private:
+    const Journal& j_;
+    uint32_t seg_;
+    File file_;
+  };
+
+private:
+  static void task(void* arg) {
+    auto* j = static_cast<Journal*>(arg);
+    for (;;) {
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(kFlushMs));
+      j->flush();
+    }
+  }
+
+  void flush() {
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    int idx = active_;
+    active_ ^= 1;
+    xSemaphoreGive(lock_);
+    size_t n = stageLen_[idx];
+    if (!n) return;
+    uint32_t t0 = micros();
+    if (file_.size() + n > kSegmentBytes) openSegment();
+    size_t w = file_ ? file_.write(stage_[idx], n) : 0;
+    if (file_) file_.flush();
+    stageLen_[idx] = 0;  // only this task touches the inactive buffer
+    uint32_t dt = micros() - t0;
+    stats_.flushes++;
+    stats_.bytesWritten += w;
+    if (w != n) stats_.writeErrors++;
+    stats_.lastFlushUs = dt;
+    if (dt > stats_.maxFlushUs) stats_.maxFlushUs = dt;
+  }
+
+  // Close the current segment, start the next one with a snapshot, and delete
+  // the oldest segments beyond kMaxSegments.
+  void openSegment() {
+    if (file_) file_.close();
+    char name[32];
+    path(name, sizeof(name), ++newest_);
+    file_ = LittleFS.open(name, "w");
+    if (file_) {
+      file_.write((const uint8_t*)kFileMagic, 4);
+      if (snapshot_) {
+        Record snap = snapshot_();
+        file_.write(snap.data(), snap.size());
+      }
+    } else {
+      stats_.writeErrors++;
+    }
+    while (newest_ - oldest_ + 1 > kMaxSegments) {
+      path(name, sizeof(name), oldest_);
+      LittleFS.remove(name);
+      oldest_++;
+      stats_.retired++;
+    }
+  }
+
+  SnapshotFn snapshot_ = nullptr;
+  SemaphoreHandle_t lock_ = nullptr;
+  TaskHandle_t task_ = nullptr;
+  bool ready_ = false;
+  File file_;
+  volatile uint32_t oldest_ = 0;
+  volatile uint32_t newest_ = 0;
+  uint8_t stage_[2][kStageBytes];
+  size_t stageLen_[2] = { 0, 0 };
+  int active_ = 0;
+  Stats stats_;
+};
+
+} // namespace journal
@@ -0,0 +1,81 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// Always-on runtime metrics: fixed-bucket latency histograms and event
+// counters. Any task records with relaxed atomic adds (no lock, no heap, a few
+// instructions); GET /api/v1/metrics and the BLE "metrics" message read them
+// racily, so a reading may mix counts taken microseconds apart but never a
+// torn word.
+namespace metrics {
+
+class Counter {
+public:
+  void add(uint32_t n = 1) { n_.fetch_add(n, std::memory_order_relaxed); }
+  uint32_t get() const { return n_.load(std::memory_order_relaxed); }
+private:
+  std::atomic<uint32_t> n_{0};
+};
+
+// Power-of-two microsecond buckets: bucket 0 is 0 us, bucket i is
+// [2^(i-1), 2^i) us, and the last bucket is open-ended (from ~262 ms).
+class Histogram {
+public:
+  static constexpr int kBuckets = 20;
+
+  // Exclusive upper bound of bucket i in microseconds; 0 for the last one.
+  static constexpr uint32_t upperUs(int i) { return i < kBuckets - 1 ? (1u << i) : 0; }
+
+  void record(uint32_t us) {
+    int i = us ? 32 - __builtin_clz(us) : 0;
+    if (i >= kBuckets) i = kBuckets - 1;
+    counts_[i].fetch_add(1, std::memory_order_relaxed);
+    uint32_t m = max_.load(std::memory_order_relaxed);
+    while (us > m && !max_.compare_exchange_weak(m, us, std::memory_order_relaxed)) {}
+  }
+
+  uint32_t bucket(int i) const { return counts_[i].load(std::memory_order_relaxed); }
+  uint32_t maxUs() const { return max_.load(std::memory_order_relaxed); }
+  uint32_t count() const {
+    uint32_t n = 0;
+    for (int i = 0; i < kBuckets; i++) n += bucket(i);
+    return n;
+  }
+
+  // Upper bound of the bucket holding the p-th percentile (0..100), so an
+  // overestimate by at most 2x; the maximum for the last bucket, 0 if empty.
+  uint32_t percentileUs(uint32_t p) const {
+    uint32_t c[kBuckets];
+    uint32_t n = 0;
+    for (int i = 0; i < kBuckets; i++) n += c[i] = bucket(i);
+    if (!n) return 0;
+    uint64_t target = ((uint64_t)n * p + 99) / 100;
+    if (!target) target = 1;
+    uint32_t seen = 0;
+    for (int i = 0; i < kBuckets; i++) {
+      seen += c[i];
+      if (seen >= target) return i < kBuckets - 1 ? upperUs(i) : maxUs();
+    }
+    return maxUs();
+  }
+
+private:
+  std::atomic<uint32_t> counts_[kBuckets] = {};
+  std::atomic<uint32_t> max_{0};
+};
+
+// Where the time goes for one update, from bytes in to bytes out.
+struct Registry {
+  Histogram parse;      // decoding one message (JSON or MessagePack)
+  Histogram apply;      // applying it to the state, journal staging included
+  Histogram render;     // one display sink run
+  Histogram broadcast;  // one run of a network sink (snapshot, BLE link, SSE, WS)
+  Counter messages;     // messages handled by the state owner
+  Counter parseErrors;  // messages that did not decode
+  Counter coalesced;    // versions a network sink folded into a later one
+  Counter bleNotifyFailed;  // notify() refused by the controller (retried)
+  Counter bleStalled;   // BLE queues dropped after a stall
+  Counter httpNoMemory; // POST bodies refused because their buffer could not be allocated
+};
+
+} // namespace metrics
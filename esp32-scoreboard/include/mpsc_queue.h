@@ -0,0 +1,63 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// Bounded lock-free multi-producer/single-consumer queue (Vyukov-style ring).
+//
+// Each cell carries a sequence number: a producer claims a slot with one CAS on
+// the head and publishes it by advancing the cell's sequence; the single
+// consumer pops cells in order without any atomic read-modify-write. push()
+// fails instead of waiting when the ring is full. N must be a power of two.
+template <typename T, size_t N>
+class MpscQueue {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be a power of two");
+
+public:
+  MpscQueue() {
+    for (size_t i = 0; i < N; i++) cells_[i].seq.store(i, std::memory_order_relaxed);
+  }
+
+  // Any task. False if the queue is full.
+  bool push(const T& v) {
+    size_t pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& c = cells_[pos & (N - 1)];
+      size_t seq = c.seq.load(std::memory_order_acquire);
+      intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+      if (dif == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          c.value = v;
+          c.seq.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (dif < 0) {
+        return false;
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Consumer only. False if empty (or the next producer has not finished).
+  bool pop(T& out) {
+    Cell& c = cells_[tail_ & (N - 1)];
+    size_t seq = c.seq.load(std::memory_order_acquire);
+    if ((intptr_t)seq - (intptr_t)(tail_ + 1) < 0) return false;
+    out = c.value;
+    c.seq.store(tail_ + N, std::memory_order_release);
+    tail_++;
+    return true;
+  }
+
+  // Approximate, for stats.
+  size_t size() const { return head_.load(std::memory_order_relaxed) - tail_; }
+
+private:
+  struct Cell {
+    std::atomic<size_t> seq;
+    T value;
+  };
+  Cell cells_[N];
+  std::atomic<size_t> head_{0};
+  size_t tail_ = 0;
+};
@@ -0,0 +1,78 @@
+#pragma once
+#include <Arduino.h>
+#include <qrcode.h>
+
+// A QR code matrix, encoded once at the smallest version that holds its
+// payload and kept until the payload changes. Drawing walks the modules as
+// horizontal runs of dark modules, with identical neighbouring rows merged, so
+// a code costs a few hundred rectangles instead of one per dark module.
+class QrMatrix {
+public:
+  static constexpr uint8_t kMaxVersion = 10; // 57x57 modules
+
+  QrMatrix() = default;
+  QrMatrix(const QrMatrix&) = delete;            // qr_.modules points into buf_
+  QrMatrix& operator=(const QrMatrix&) = delete;
+
+  // Encodes `payload` unless it is already the cached one. False if it does
+  // not fit in kMaxVersion.
+  bool set(const String& payload) {
+    if (valid_ && payload == payload_) return true;
+    payload_ = payload;
+    valid_ = false;
+    uint8_t v = smallestVersion(payload.length());
+    if (!v) return false;
+    valid_ = qrcode_initText(&qr_, buf_, v, ECC_MEDIUM, payload.c_str()) == 0;
+    return valid_;
+  }
+
+  // Forces the next set() to encode again (e.g. credentials changed).
+  void invalidate() { valid_ = false; }
+
+  bool valid() const { return valid_; }
+  uint8_t version() const { return valid_ ? qr_.version : 0; }
+  uint8_t size() const { return valid_ ? qr_.size : 0; }
+  bool dark(uint8_t x, uint8_t y) const { return qrcode_getModule(const_cast<QRCode*>(&qr_), x, y); }
+
+  // Calls span(x, y, width, height), in modules, for every run of dark
+  // modules. A run of rows that are identical is reported once, `height` tall.
+  template <typename Span>
+  void forEachSpan(Span&& span) const {
+    const uint8_t n = size();
+    for (uint8_t y = 0; y < n;) {
+      uint8_t h = 1;
+      while (y + h < n && sameRow(y, y + h)) h++;
+      for (uint8_t x = 0; x < n;) {
+        if (!dark(x, y)) { x++; continue; }
+        uint8_t x0 = x;
+        while (x < n && dark(x, y)) x++;
+        span(x0, y, x - x0, h);
+      }
+      y += h;
+    }
+  }
+
+private:
+  // Byte-mode capacity at ECC_MEDIUM, versions 1..kMaxVersion. Alphanumeric or
+  // numeric payloads would fit in less, so this never picks a version too small.
+  static uint8_t smallestVersion(size_t len) {
+    static const uint8_t kCapacity[kMaxVersion] = { 14, 26, 42, 62, 84, 106, 122, 152, 180, 213 };
+    for (uint8_t v = 1; v <= kMaxVersion; v++) {
+      if (len <= kCapacity[v - 1]) return v;
+    }
+    return 0;
+  }
+
+  bool sameRow(uint8_t a, uint8_t b) const {
+    for (uint8_t x = 0; x < qr_.size; x++) {
+      if (dark(x, a) != dark(x, b)) return false;
+    }
+    return true;
+  }
+
+  static constexpr uint16_t kBufSize = ((4 * kMaxVersion + 17) * (4 * kMaxVersion + 17) + 7) / 8;
+  uint8_t buf_[kBufSize];
+  QRCode qr_ = {};
+  String payload_;
+  bool valid_ = false;
+};
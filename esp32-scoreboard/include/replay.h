@@ -0,0 +1,56 @@
+#pragma once
+#include <Arduino.h>
+#include <deque>
+#include <string>
+
+// The last few patches a sink sent, as a chain (each one's base is the previous
+// one's version), so a client that reconnects with the version it last saw can
+// be sent just what it missed. Bounded by count and by bytes; the oldest
+// patches go first. Not thread-safe: the owner of the ring locks around it.
+class ReplayRing {
+public:
+  ReplayRing(size_t maxEvents, size_t maxBytes) : maxEvents_(maxEvents), maxBytes_(maxBytes) {}
+
+  // A patch from `base` to `version`. A patch that does not continue the chain
+  // starts a new one.
+  void push(uint32_t base, uint32_t version, const std::string& payload) {
+    if (!events_.empty() && events_.back().version != base) clear();
+    events_.push_back({ base, version, payload });
+    bytes_ += payload.size();
+    while (events_.size() > maxEvents_ || (bytes_ > maxBytes_ && events_.size() > 1)) {
+      bytes_ -= events_.front().payload.size();
+      events_.pop_front();
+    }
+  }
+
+  void clear() { events_.clear(); bytes_ = 0; }
+
+  // Calls emit(version, payload) for every patch after version `from`, oldest
+  // first. False, without emitting, if the ring does not reach back to `from`.
+  template <typename Emit>
+  bool replay(uint32_t from, Emit&& emit) const {
+    if (!from || events_.empty()) return false;
+    if (from == events_.back().version) return true;
+    size_t i = 0;
+    while (i < events_.size() && events_[i].base != from) i++;
+    if (i == events_.size()) return false;
+    for (; i < events_.size(); i++) emit(events_[i].version, events_[i].payload);
+    return true;
+  }
+
+  size_t size() const { return events_.size(); }
+  size_t bytes() const { return bytes_; }
+  uint32_t oldest() const { return events_.empty() ? 0 : events_.front().base; }
+  uint32_t newest() const { return events_.empty() ? 0 : events_.back().version; }
+
+private:
+  struct Event {
+    uint32_t base;
+    uint32_t version;
+    std::string payload;
+  };
+  std::deque<Event> events_;
+  size_t maxEvents_;
+  size_t maxBytes_;
+  size_t bytes_ = 0;
+};
@@ -0,0 +1,149 @@
+#pragma once
+#include <Arduino.h>
+#include "display.h"
+
+// Scoring commands applied on the device, so a tap costs a few bytes on the
+// wire and two controllers never overwrite each other with stale full states.
+// The rules mirror the PWA's offline fallback in app.js.
+namespace scoring {
+
+enum class Op : uint8_t { Point, Minus, Void, SideOut, Served, WonSet, ClearSet, EndSet, Undo, Redo, Unknown };
+
+inline Op opFromName(const char* name) {
+  static const struct { const char* name; Op op; } kOps[] = {
+    { "point", Op::Point }, { "minus", Op::Minus }, { "void", Op::Void },
+    { "sideout", Op::SideOut }, { "served", Op::Served }, { "wonSet", Op::WonSet },
+    { "clearSet", Op::ClearSet }, { "endSet", Op::EndSet }, { "undo", Op::Undo }, { "redo", Op::Redo },
+  };
+  for (auto& o : kOps) if (name && strcmp(name, o.name) == 0) return o.op;
+  return Op::Unknown;
+}
+
+// Everything a scoring command can change. Names, colors and rotations are
+// left out, so undo never reverts an edit made in between.
+struct Score {
+  int a, b, set, ma, mb;
+  char sv;
+  uint8_t rsa, rsb;
+  ScoreboardState::LogEntry la[4], lb[4];
+  uint8_t laCount, lbCount;
+
+  static Score of(const ScoreboardState& s) {
+    Score o;
+    o.a = s.a; o.b = s.b; o.set = s.set; o.ma = s.ma; o.mb = s.mb;
+    o.sv = s.sv; o.rsa = s.rsa; o.rsb = s.rsb;
+    memcpy(o.la, s.la, sizeof(o.la)); memcpy(o.lb, s.lb, sizeof(o.lb));
+    o.laCount = s.laCount; o.lbCount = s.lbCount;
+    return o;
+  }
+  void restore(ScoreboardState& s) const {
+    s.a = a; s.b = b; s.set = set; s.ma = ma; s.mb = mb;
+    s.sv = sv; s.rsa = rsa; s.rsb = rsb;
+    memcpy(s.la, la, sizeof(la)); memcpy(s.lb, lb, sizeof(lb));
+    s.laCount = laCount; s.lbCount = lbCount;
+  }
+};
+
+// Fixed-size undo/redo rings of Score snapshots. A new command clears redo;
+// when the undo ring is full the oldest step is forgotten.
+template <size_t N>
+class History {
+public:
+  // `before` is the score as it was just before a command was applied.
+  void record(const Score& before) { push(undo_, undoCount_, before); redoCount_ = 0; }
+
+  bool undo(ScoreboardState& s) { return step(s, undo_, undoCount_, redo_, redoCount_); }
+  bool redo(ScoreboardState& s) { return step(s, redo_, redoCount_, undo_, undoCount_); }
+
+  size_t undoDepth() const { return undoCount_; }
+  size_t redoDepth() const { return redoCount_; }
+
+private:
+  // Rings are stored oldest-first ending at count-1, with `head` as the base.
+  struct Ring { Score items[N]; size_t head = 0; };
+
+  static void push(Ring& r, size_t& count, const Score& v) {
+    if (count == N) { r.head = (r.head + 1) % N; count--; }
+    r.items[(r.head + count) % N] = v;
+    count++;
+  }
+  static bool step(ScoreboardState& s, Ring& from, size_t& fromCount, Ring& to, size_t& toCount) {
+    if (!fromCount) return false;
+    push(to, toCount, Score::of(s));
+    fromCount--;
+    from.items[(from.head + fromCount) % N].restore(s);
+    return true;
+  }
+
+  Ring undo_, redo_;
+  size_t undoCount_ = 0, redoCount_ = 0;
+};
+
+// Match wins and the set number stay within what applyDataObject accepts
+// (0..9 and 1..9), however many sets are won or ended.
+constexpr int kMaxMatchWins = 9;
+constexpr int kMaxSet = 9;
+
+inline void addLog(ScoreboardState& s, char team, const char* reason, const char* scorer, uint64_t ts) {
+  ScoreboardState::LogEntry* log = team == 'A' ? s.la : s.lb;
+  uint8_t& count = team == 'A' ? s.laCount : s.lbCount;
+  if (count == 4) { memmove(log, log + 1, 3 * sizeof(*log)); count = 3; }
+  setText(log[count].reason, reason);
+  setText(log[count].scorer, scorer);
+  log[count].ts = ts;
+  count++;
+}
+
+// Apply one scoring command (not Undo/Redo) for `team` ('A' or 'B'); `ts` is
+// the controller's epoch ms for the log entry. Returns false on a bad op/team.
+inline bool apply(ScoreboardState& s, Op op, char team, uint64_t ts) {
+  if (team != 'A' && team != 'B' && op != Op::ClearSet && op != Op::EndSet) return false;
+  int& score = team == 'A' ? s.a : s.b;
+  switch (op) {
+    case Op::Point:
+      if (score < 99) score++;
+      addLog(s, team, "Manual +1", "", ts);
+      return true;
+    case Op::Minus:
+    case Op::Void:
+      if (score > 0) score--;
+      addLog(s, team, op == Op::Void ? "Voided previous point" : "Manual -1", "", ts);
+      return true;
+    case Op::SideOut: {
+      // Receiving team gains serve and rotates one position
+      s.sv = team;
+      uint8_t& rs = team == 'A' ? s.rsa : s.rsb;
+      rs = (rs + 1) % 6;
+      addLog(s, team, "Side out: gained serve", "", ts);
+      return true;
+    }
+    case Op::Served:
+      // Same server continues on the point
+      if (score < 99) score++;
+      addLog(s, team, "Served and scored", team == 'A' ? s.ra[s.rsa] : s.rb[s.rsb], ts);
+      return true;
+    case Op::WonSet: {
+      int& wins = team == 'A' ? s.ma : s.mb;
+      if (wins < kMaxMatchWins) wins++;
+      addLog(s, team, "Won set", "", ts);
+      s.a = 0; s.b = 0;
+      if (s.set < kMaxSet) s.set++;
+      return true;
+    }
+    case Op::ClearSet:
+      s.a = 0; s.b = 0;
+      addLog(s, 'A', "Set cleared", "", ts);
+      addLog(s, 'B', "Set cleared", "", ts);
+      return true;
+    case Op::EndSet:
+      if (s.a > s.b && s.ma < kMaxMatchWins) s.ma++;
+      else if (s.b > s.a && s.mb < kMaxMatchWins) s.mb++;
+      s.a = 0; s.b = 0;
+      if (s.set < kMaxSet) s.set++;
+      return true;
+    default:
+      return false;
+  }
+}
+
+} // namespace scoring
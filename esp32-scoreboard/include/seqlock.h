@@ -0,0 +1,46 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// Single-writer sequence lock around a trivially copyable value.
+//
+// The writer bumps the sequence to odd, copies, and bumps it back to even;
+// readers copy optimistically and retry if the sequence was odd or moved, so a
+// reader never blocks the writer and never takes a lock. Writers must already
+// be serialized by the caller.
+template <typename T>
+class SeqLock {
+public:
+  void store(const T& v) {
+    uint32_t s = seq_.load(std::memory_order_relaxed);
+    seq_.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&data_, &v, sizeof(T));
+    seq_.store(s + 2, std::memory_order_release);
+  }
+
+  // Calls copy(const T&) until it ran against a stable value; `copy` must only
+  // copy out, since it may see a torn value on a retried pass. Returns the
+  // number of retries.
+  template <typename Copy>
+  uint32_t read(Copy&& copy) const {
+    uint32_t retries = 0;
+    for (;;) {
+      uint32_t s1 = seq_.load(std::memory_order_acquire);
+      if (!(s1 & 1)) {
+        copy(data_);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq_.load(std::memory_order_relaxed) == s1) return retries;
+      }
+      // A writer on the same core may have been preempted mid-copy by this
+      // reader; after a short spin, sleep a tick so it can finish.
+      if (++retries % 64 == 0) vTaskDelay(1);
+    }
+  }
+
+  uint32_t load(T& out) const { return read([&](const T& v) { memcpy(&out, &v, sizeof(T)); }); }
+
+private:
+  std::atomic<uint32_t> seq_{0};
+  T data_;
+};
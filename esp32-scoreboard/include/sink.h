@@ -0,0 +1,70 @@
+#pragma once
+#include <Arduino.h>
+
+// Rate gate for one consumer of state versions (display, BLE, SSE, ...).
+//
+// Producers only bump the version and call pending(); each sink decides on its
+// own schedule whether to run, and when it does it handles the newest version,
+// so a burst of updates collapses into one run per interval. Counters are plain
+// words written by the sink's own task and read racily by the stats endpoint.
+class SinkGate {
+public:
+  static constexpr uint32_t kIdle = UINT32_MAX;
+
+  SinkGate(const char* name, uint32_t minIntervalMs) : name_(name), intervalMs_(minIntervalMs) {}
+
+  const char* name() const { return name_; }
+  uint32_t intervalMs() const { return intervalMs_; }
+  void setInterval(uint32_t ms) { intervalMs_ = ms; }
+
+  // A new version exists (any task). Starts the latency clock if idle.
+  void pending(uint32_t nowMs) {
+    if (!pendingSinceMs_) pendingSinceMs_ = nowMs ? nowMs : 1;
+  }
+
+  // Milliseconds until this sink may run for version `v`: 0 = now, kIdle =
+  // already up to date.
+  uint32_t waitMs(uint32_t v, uint32_t nowMs) const {
+    if (v == version_) return kIdle;
+    uint32_t since = nowMs - lastRunMs_;
+    return since >= intervalMs_ ? 0 : intervalMs_ - since;
+  }
+  bool due(uint32_t v, uint32_t nowMs) const { return waitMs(v, nowMs) == 0; }
+
+  // The sink handled version `v`, taking `us` microseconds. Returns how many
+  // versions this run folded in.
+  uint32_t ran(uint32_t v, uint32_t nowMs, uint32_t us) {
+    uint32_t folded = version_ && v > version_ + 1 ? v - version_ - 1 : 0;
+    coalesced_ += folded;
+    version_ = v;
+    lastRunMs_ = nowMs;
+    runs_++;
+    lastRunUs_ = us;
+    if (us > maxRunUs_) maxRunUs_ = us;
+    if (pendingSinceMs_) {
+      uint32_t lat = nowMs - pendingSinceMs_;
+      if (lat > maxLatencyMs_) maxLatencyMs_ = lat;
+      pendingSinceMs_ = 0;
+    }
+    return folded;
+  }
+
+  uint32_t version() const { return version_; }     // last version handled
+  uint32_t runs() const { return runs_; }
+  uint32_t coalesced() const { return coalesced_; } // versions never handled on their own
+  uint32_t lastRunUs() const { return lastRunUs_; }
+  uint32_t maxRunUs() const { return maxRunUs_; }
+  uint32_t maxLatencyMs() const { return maxLatencyMs_; }  // change -> handled
+
+private:
+  const char* name_;
+  volatile uint32_t intervalMs_;
+  volatile uint32_t pendingSinceMs_ = 0;
+  uint32_t version_ = 0;
+  uint32_t lastRunMs_ = 0;
+  uint32_t runs_ = 0;
+  uint32_t coalesced_ = 0;
+  uint32_t lastRunUs_ = 0;
+  uint32_t maxRunUs_ = 0;
+  uint32_t maxLatencyMs_ = 0;
+};
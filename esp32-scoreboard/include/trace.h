@@ -0,0 +1,112 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include <utility>
+
+// End-to-end latency tracing for messages that carry a correlation id ("cid").
+//
+// The state owner stamps receipt, parse and apply into a Trace, then parks the
+// message's reply here together with the state version it produced. The
+// display and network sinks stamp the stages they run for that version (or a
+// later one that folded it in), and once every expected stage is in, or the
+// timeout passes, take() hands the trace and the parked reply back to be sent.
+// Untraced traffic only pays one relaxed atomic load per stamp.
+namespace trace {
+
+constexpr size_t kCidLen = 16;
+
+enum Stage : uint8_t {
+  Start,        // state owner picked the message up
+  Parsed,       // decoded
+  Applied,      // applied to the state
+  RenderStart,  // display sink began drawing that version
+  RenderEnd,    // ... and finished
+  Ble,          // BLE sink handed it to the controller
+  Sse,          // SSE sink queued it to its clients
+  Ws,           // WebSocket sink queued it to its clients
+  kStages
+};
+
+struct Trace {
+  char cid[kCidLen + 1] = "";
+  uint32_t rxUs = 0;            // micros() when the transport queued the message
+  uint32_t version = 0;         // state version the message produced
+  uint32_t at[kStages] = {};    // micros() per stage, valid if `seen` has its bit
+  uint16_t seen = 0;
+  uint16_t wait = 0;            // stages still expected
+  bool timedOut = false;
+
+  bool active() const { return cid[0] != 0; }
+  void mark(Stage s, uint32_t us) {
+    at[s] = us;
+    seen |= 1u << s;
+    wait &= ~(1u << s);
+  }
+  bool has(Stage s) const { return seen & (1u << s); }
+};
+
+// Fixed slots of open traces, each with the reply parked until it completes.
+template <typename Payload, size_t N>
+class Table {
+public:
+  void begin() { lock_ = xSemaphoreCreateMutex(); }
+
+  // Owner task. Takes the payload; false (payload untouched) if every slot is busy.
+  bool open(const Trace& t, Payload& p) {
+    bool ok = false;
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    for (auto& s : slots_) {
+      if (s.t.active()) continue;
+      s.t = t;
+      s.p = std::move(p);
+      open_.fetch_add(1, std::memory_order_relaxed);
+      ok = true;
+      break;
+    }
+    xSemaphoreGive(lock_);
+    return ok;
+  }
+
+  // Any sink: stage `s` ran for version `v` at `us`.
+  void stamp(Stage s, uint32_t v, uint32_t us) {
+    if (!open_.load(std::memory_order_relaxed)) return;
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    for (auto& slot : slots_) {
+      Trace& t = slot.t;
+      if (t.active() && t.version <= v && !t.has(s)) t.mark(s, us);
+    }
+    xSemaphoreGive(lock_);
+  }
+
+  // Calls done(Trace&, Payload&) outside the lock for every trace that is
+  // complete or older than `timeoutUs`.
+  template <typename Done>
+  void take(uint32_t nowUs, uint32_t timeoutUs, Done&& done) {
+    if (!open_.load(std::memory_order_relaxed)) return;
+    for (auto& slot : slots_) {
+      xSemaphoreTake(lock_, portMAX_DELAY);
+      if (!slot.t.active() || (slot.t.wait && nowUs - slot.t.rxUs <= timeoutUs)) {
+        xSemaphoreGive(lock_);
+        continue;
+      }
+      Trace t = slot.t;
+      t.timedOut = t.wait != 0;
+      Payload p(std::move(slot.p));
+      slot.t = Trace();
+      open_.fetch_sub(1, std::memory_order_relaxed);
+      xSemaphoreGive(lock_);
+      done(t, p);
+    }
+  }
+
+private:
+  struct Slot {
+    Trace t;
+    Payload p;
+  };
+  Slot slots_[N];
+  SemaphoreHandle_t lock_ = nullptr;
+  std::atomic<uint32_t> open_{0};
+};
+
+} // namespace trace
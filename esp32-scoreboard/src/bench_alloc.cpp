@@ -0,0 +1,81 @@
+// Allocation counting for the hot-path benchmarks (bench.h). The bench envs
+// link with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc, so every call to
+// those from the firmware, ArduinoJson and the framework archives lands here
+// first. Only the task that called trackAllocs(true) is counted.
+#ifdef HOT_PATH_BENCH
+#include <Arduino.h>
+#include <new>
+#include "bench.h"
+
+extern "C" {
+void* __real_malloc(size_t n);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* p, size_t n);
+}
+
+namespace {
+volatile TaskHandle_t gTracked = nullptr;
+volatile uint32_t gAllocs = 0;
+volatile uint64_t gBytes = 0;
+
+TaskHandle_t self() {
+#ifdef HOST_BUILD
+  return host::taskSlot();  // never allocates, unlike xTaskGetCurrentTaskHandle() on a fresh thread
+#else
+  return xTaskGetCurrentTaskHandle();
+#endif
+}
+
+inline void count(size_t n) {
+  TaskHandle_t t = gTracked;
+  if (!t || self() != t) return;
+  gAllocs = gAllocs + 1;
+  gBytes = gBytes + n;
+}
+} // namespace
+
+extern "C" {
+void* __wrap_malloc(size_t n) {
+  count(n);
+  return __real_malloc(n);
+}
+void* __wrap_calloc(size_t n, size_t size) {
+  count(n * size);
+  return __real_calloc(n, size);
+}
+void* __wrap_realloc(void* p, size_t n) {
+  count(n);
+  return __real_realloc(p, n);
+}
+}
+
+#ifdef HOST_BUILD
+// libstdc++ is a shared library on the host, so its operator new does not see
+// the wrap; route it through malloc here (the ESP32 links it statically).
+void* operator new(size_t n) {
+  if (void* p = malloc(n ? n : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+#endif
+
+namespace bench {
+void trackAllocs(bool on) {
+  if (on) {
+    gAllocs = 0;
+    gBytes = 0;
+    gTracked = xTaskGetCurrentTaskHandle();
+  } else {
+    gTracked = nullptr;
+  }
+}
+
+AllocCounters allocCounters() {
+  AllocCounters a;
+  a.allocs = gAllocs;
+  a.bytes = gBytes;
+  return a;
+}
+} // namespace bench
+#endif
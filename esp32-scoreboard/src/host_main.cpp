@@ -0,0 +1,244 @@
+// Host simulator, built only by [env:native] (HOST_BUILD). Boots the firmware
+// on the stand-ins in host/include and plays a phone and two browsers against
+// it: BLE writes and notifications, HTTP POST/GET, SSE and WebSocket. Each step
+// is checked; the panel is saved as scoreboard.ppm and the exit status is the
+// number of failed checks.
+//
+//   pio run -e native && .pio/build/native/program
+//
+// Left out of `pio test -e native`, whose tests bring their own main().
+#if defined(HOST_BUILD) && !defined(PIO_UNIT_TESTING)
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <NimBLEDevice.h>
+#include <string>
+#include <vector>
+#include "ble_frame.h"
+#include "display.h"
+#include "scoring.h"
+
+void setup();
+void loop();
+extern AsyncWebServer server;
+extern AsyncEventSource events;
+extern AsyncWebSocket ws;
+extern DisplayRenderer* renderer;
+#ifdef SOAK_TEST
+int runSoak();  // src/host_soak.cpp
+#endif
+
+namespace {
+const NimBLEUUID kRxChar("6e400002-b5a3-f393-e0a9-e50e24dcca9e");
+const NimBLEUUID kTxChar("6e400003-b5a3-f393-e0a9-e50e24dcca9e");
+int gFailures = 0;
+
+void check(bool ok, const char* what) {
+  Serial.printf("[SIM] %s %s\n", ok ? "ok  " : "FAIL", what);
+  if (!ok) gFailures++;
+}
+
+bool contains(const std::string& s, const char* needle) { return s.find(needle) != std::string::npos; }
+
+// Runs loop() (touch, snapshot and display sinks) until done() or `ms` pass.
+template <typename Done>
+bool runUntil(Done&& done, uint32_t ms = 1000) {
+  uint32_t t0 = millis();
+  while (!done()) {
+    if (millis() - t0 > ms) return false;
+    loop();
+  }
+  return true;
+}
+
+// A phone on BLE: writes fragmented like ble.js, reassembles notifications.
+struct Central {
+  uint16_t conn;
+  uint16_t mtu;
+  uint8_t nextId = 0;
+  bleframe::Reassembler rx;
+  std::vector<std::string> messages;
+
+  void connect() {
+    NimBLEDevice::host::connect(conn, mtu);
+    NimBLEDevice::host::subscribe(conn, kTxChar);
+  }
+  void send(const std::string& msg) {
+    bleframe::split((const uint8_t*)msg.data(), msg.size(), mtu - 3, nextId++, [&](const uint8_t* p, size_t n) {
+      NimBLEDevice::host::write(conn, kRxChar, p, n);
+      return true;
+    });
+  }
+  void poll() {
+    for (auto& n : NimBLEDevice::host::take(conn)) {
+      if (rx.feed(n.data(), n.size(), millis()) == bleframe::Reassembler::Complete) {
+        messages.emplace_back((const char*)rx.data(), rx.size());
+      }
+    }
+  }
+  // Waits for a message containing `needle` and drops everything before it.
+  bool expect(const char* needle, uint32_t ms = 1000) {
+    return runUntil([&] {
+      poll();
+      for (size_t i = 0; i < messages.size(); i++) {
+        if (contains(messages[i], needle)) { messages.erase(messages.begin(), messages.begin() + i + 1); return true; }
+      }
+      return false;
+    }, ms);
+  }
+};
+
+bool wsExpect(AsyncWebSocketClient* c, const char* needle, uint32_t ms = 1000) {
+  std::vector<AsyncWebSocketClient::Message> seen;
+  return runUntil([&] {
+    for (auto& m : c->take()) seen.push_back(m);
+    for (auto& m : seen) if (!m.binary && contains(m.data, needle)) return true;
+    return false;
+  }, ms);
+}
+
+uint32_t gSseLastId = 0;  // id of the event sseExpect() last matched
+
+bool sseExpect(AsyncEventSourceClient* c, const char* needle, uint32_t ms = 1000) {
+  std::vector<AsyncEventSourceClient::Event> seen;
+  return runUntil([&] {
+    for (auto& e : c->take()) seen.push_back(e);
+    for (auto& e : seen) if (contains(e.data, needle)) { gSseLastId = e.id; return true; }
+    return false;
+  }, ms);
+}
+} // namespace
+
+int main() {
+  setup();
+#ifdef HOT_PATH_BENCH
+  fflush(stdout);
+  _Exit(0);  // [env:native_bench]: setup() has printed the numbers
+#endif
+#ifdef SOAK_TEST
+  int failedGates = runSoak();
+  fflush(stdout);
+  _Exit(failedGates);  // [env:native_soak]
+#endif
+
+  auto ping = server.request(HTTP_GET, "/api/v1/ping");
+  check(ping.code == 200 && ping.body == "pong", "GET /api/v1/ping");
+
+  // BLE: a subscriber gets the full state, then echoes of its own writes.
+  Central phone{ 1, 185 };
+  phone.connect();
+  check(phone.expect("\"type\":\"state\""), "BLE subscribe gets full state");
+  phone.send("{\"type\":\"state\",\"data\":{\"ta\":\"Home\",\"tb\":\"Away\",\"a\":12,\"b\":9}}");
+  check(phone.expect("\"a\":12"), "BLE write echoed as patch/state");
+
+  // A message bigger than one packet goes out in framed fragments.
+  std::string logs = "{\"type\":\"state\",\"data\":{\"la\":[";
+  for (int i = 0; i < 12; i++) logs += (i ? "," : "") + std::string("{\"reason\":\"kill\",\"scorer\":\"7\",\"ts\":17000000000") + std::to_string(i) + "}";
+  logs += "]}}";
+  phone.send(logs);
+  check(phone.expect("kill"), "BLE fragmented write applied");
+
+  // HTTP: POST is answered by the state owner; GET carries the new version.
+  auto post = server.request(HTTP_POST, "/api/v1/scoreboard", "{\"type\":\"state\",\"data\":{\"a\":13}}",
+                             { AsyncWebHeader("Content-Type", "application/json") });
+  check(post.code == 200 && contains(post.body, "\"ack\""), "POST /api/v1/scoreboard acked");
+  check(runUntil([] { return contains(server.request(HTTP_GET, "/api/v1/state").body, "\"a\":13"); }),
+        "GET /api/v1/state reflects POST");
+  auto got = server.request(HTTP_GET, "/api/v1/state");
+  const AsyncWebHeader* etag = got.header("ETag");
+  check(etag && etag->value().indexOf('.') > 1, "ETag carries the boot id and version");
+  auto same = server.request(HTTP_GET, "/api/v1/state", "", { AsyncWebHeader("If-None-Match", etag ? etag->value() : "") });
+  check(same.code == 304, "If-None-Match with the current ETag gets 304");
+  auto bad = server.request(HTTP_POST, "/api/v1/scoreboard", "{nope", { AsyncWebHeader("Content-Type", "application/json") });
+  check(bad.code == 400, "POST with bad JSON gets 400");
+
+  // SSE and WebSocket: full state on connect, then updates from other transports.
+  AsyncEventSourceClient* sse = events.hostConnect();
+  check(sse && sseExpect(sse, "\"a\":13"), "SSE connect gets full state");
+  AsyncWebSocketClient* wsc = ws.hostConnect();
+  check(wsExpect(wsc, "\"a\":13"), "WebSocket connect gets full state");
+  ws.hostSend(wsc, "{\"type\":\"state\",\"data\":{\"b\":10},\"id\":7}", false, 3);
+  check(wsExpect(wsc, "\"id\":7"), "WebSocket request acked with its id");
+  check(sseExpect(sse, "\"b\":10"), "SSE sees WebSocket update");
+  // Reconnects: the id just seen resumes where it left off; the same version
+  // under another boot's tag (versions restart at 1) starts over.
+  AsyncEventSourceClient* resumed = events.hostConnect(gSseLastId);
+  check(resumed && !sseExpect(resumed, "\"type\":\"state\"", 100), "SSE reconnect with a current id is not sent the state again");
+  AsyncEventSourceClient* rebooted = events.hostConnect(gSseLastId ^ (1u << 30));
+  check(rebooted && sseExpect(rebooted, "\"type\":\"state\""), "SSE id from another boot gets the full state");
+  if (resumed) events.hostDisconnect(resumed);
+  if (rebooted) events.hostDisconnect(rebooted);
+  check(phone.expect("\"b\":10"), "BLE sees WebSocket update");
+
+  // A second central shares the broadcast; each gets only its own replies.
+  Central coach{ 2, 23 };
+  coach.connect();
+  check(coach.expect("\"type\":\"state\""), "second central gets full state at MTU 23");
+  coach.send("{\"type\":\"resync\"}");
+  check(coach.expect("\"type\":\"state\""), "resync answered on the asking central");
+
+  // Metrics: the same document over HTTP and as a BLE reply.
+  auto metrics = server.request(HTTP_GET, "/api/v1/metrics");
+  check(metrics.code == 200 && contains(metrics.body, "\"bucketsUs\""), "GET /api/v1/metrics");
+  phone.send("{\"type\":\"metrics\"}");
+  check(phone.expect("\"type\":\"metrics\""), "BLE metrics message answered");
+
+  // Journal: the export streams the segments; the stats are their own route.
+  auto exported = server.request(HTTP_GET, "/api/v1/journal");
+  check(exported.code == 200 && exported.body.compare(0, 4, "VSJ1") == 0, "GET /api/v1/journal streams segments");
+  auto jstats = server.request(HTTP_GET, "/api/v1/journal/stats");
+  check(jstats.code == 200 && contains(jstats.body, "\"retired\""), "GET /api/v1/journal/stats");
+
+  // Scoring commands stay within what a state message may set.
+  {
+    ScoreboardState st;
+    st.set = 9;
+    st.ma = 9;
+    scoring::apply(st, scoring::Op::WonSet, 'A', 0);
+    check(st.set == 9 && st.ma == 9, "wonSet at set 9 with 9 wins stays at 9");
+    st.b = 3;
+    scoring::apply(st, scoring::Op::EndSet, 0, 0);
+    check(st.set == 9 && st.mb == 1, "endSet at set 9 stays at 9");
+  }
+
+  // Display: let the sink render, then keep the frame for a look.
+  runUntil([] { return false; }, 300);
+#ifdef USE_TFT_ESPI
+  TFT_eSPI& panel = static_cast<TftRenderer*>(renderer)->panel();
+  bool drawn = false;
+  for (int y = 0; y < panel.height() && !drawn; y++)
+    for (int x = 0; x < panel.width() && !drawn; x++) drawn = panel.pixel(x, y) != TFT_BLACK;
+  check(drawn, "scoreboard rendered");
+  check(panel.writePPM("scoreboard.ppm"), "panel saved to scoreboard.ppm");
+
+  // Touch: the controller is only read between the IRQ edge and release.
+  TftRenderer& tft = *static_cast<TftRenderer*>(renderer);
+  uint32_t reads = panel.touchReads();
+  runUntil([] { return false; }, 200);
+  check(panel.touchReads() == reads, "touch controller left alone while idle");
+  panel.hostTouch(true, 160, 120);
+  runUntil([] { return false; }, 60);
+  panel.hostTouch(false);
+  check(runUntil([&] { return tft.showingQr(); }, 300), "tap switches to the QR view");
+  for (int x = 220; x >= 100; x -= 30) {
+    panel.hostTouch(true, x, 120);
+    runUntil([] { return false; }, 25);
+  }
+  panel.hostTouch(false);
+  check(runUntil([&] { return !tft.showingQr(); }, 300), "swipe switches back to the scoreboard");
+  reads = panel.touchReads();
+  panel.hostTouch(true, 160, 120);
+  runUntil([] { return false; }, 1000);
+  panel.hostTouch(false);
+  check(panel.touchReads() - reads < 100, "touch sampled at a bounded rate while held");
+  check(phone.expect("Set cleared"), "long-press clears the set");
+#endif
+
+  events.hostDisconnect(sse);
+  ws.hostDisconnect(wsc);
+  NimBLEDevice::host::disconnect(coach.conn);
+  NimBLEDevice::host::disconnect(phone.conn);
+  Serial.printf("[SIM] %d check(s) failed\n", gFailures);
+  fflush(stdout);
+  _Exit(gFailures);  // the firmware's tasks never return
+}
+#endif
@@ -0,0 +1,764 @@
+// Soak harness, built only by [env:native_soak] (HOST_BUILD + SOAK_TEST).
+// Boots the firmware on the host stand-ins like the simulator, then drives its
+// message layer for SOAK_SECONDS while loop() keeps rendering:
+//   - ten controllers: 3 BLE centrals, 4 WebSocket clients, 3 HTTP posters,
+//     sending scoring commands and name changes at SOAK_RATE updates/s;
+//   - vandals on BLE, WebSocket and HTTP sending garbage and oversized messages;
+//   - two SSE listeners and a WebSocket listener that, like every controller,
+//     rebuild the state from the broadcasts they receive.
+//
+// SOAK_PROFILE picks the traffic: drip (steady rate), rally (every controller
+// bursts three points at once, once a second), garbage (drip plus bursts of
+// malformed messages), oversize (drip plus bodies over 4 KB) or mixed (the
+// four in turn, 10 s each; the default).
+//
+// Every 5 s, and before a score could reach its cap, traffic pauses for a
+// checkpoint. The score must equal the points the device acknowledged. Every
+// listener must hold the same version, score and names as GET /api/v1/state,
+// and no patch may skip a version. The report gives throughput, ack and
+// broadcast latency per transport, heap growth and the gates below. The exit
+// status is the number of failed gates.
+//
+//   pio run -e native_soak && SOAK_SECONDS=3600 .pio/build/native_soak/program
+#if defined(HOST_BUILD) && defined(SOAK_TEST)
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+#include <NimBLEDevice.h>
+#include <malloc.h>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ble_frame.h"
+
+void loop();
+extern AsyncWebServer server;
+extern AsyncEventSource events;
+extern AsyncWebSocket ws;
+
+namespace {
+const NimBLEUUID kRxChar("6e400002-b5a3-f393-e0a9-e50e24dcca9e");
+const NimBLEUUID kTxChar("6e400003-b5a3-f393-e0a9-e50e24dcca9e");
+
+constexpr uint32_t kCheckpointUs = 5000000;
+constexpr uint32_t kPhaseUs = 10000000;    // mixed: time per profile
+constexpr uint32_t kLostUs = 3000000;      // no reply by then: lost
+constexpr uint32_t kMaxInFlight = 4;       // per controller
+constexpr int kScoreCap = 80;              // checkpoint and reset before 99
+constexpr size_t kOversize = 5000;         // over the 4 KB message limit
+const std::vector<AsyncWebHeader> kJson = { AsyncWebHeader("Content-Type", "application/json") };
+
+enum Via : uint8_t { Ble, Http, Ws, kVias };
+const char* const kViaName[] = { "ble", "http", "ws" };
+
+enum class Profile : uint8_t { Drip, Rally, Garbage, Oversize, Mixed };
+const char* const kProfileName[] = { "drip", "rally", "garbage", "oversize", "mixed" };
+
+struct Config {
+  uint32_t seconds = 60;
+  Profile profile = Profile::Mixed;
+  uint32_t rate = 50;          // controller updates per second
+  uint32_t p99Ms = 250;        // broadcast latency gate
+  uint32_t maxGrowthKb = 256;  // heap growth gate, first to last checkpoint
+
+  static uint32_t env(const char* name, uint32_t def) {
+    const char* v = getenv(name);
+    return v && *v ? (uint32_t)strtoul(v, nullptr, 10) : def;
+  }
+  void load() {
+    seconds = env("SOAK_SECONDS", seconds);
+    rate = std::max<uint32_t>(1, env("SOAK_RATE", rate));
+    p99Ms = env("SOAK_P99_MS", p99Ms);
+    maxGrowthKb = env("SOAK_MAX_GROWTH_KB", maxGrowthKb);
+    if (const char* p = getenv("SOAK_PROFILE")) {
+      for (int i = 0; i <= (int)Profile::Mixed; i++) if (!strcmp(p, kProfileName[i])) profile = (Profile)i;
+    }
+  }
+};
+
+// Latencies in 50 us steps up to 2 s, allocated up front so the harness does
+// not grow the heap it is measuring.
+struct Samples {
+  static constexpr uint32_t kStepUs = 50;
+  static constexpr uint32_t kSteps = 40000;
+  std::vector<uint32_t> n = std::vector<uint32_t>(kSteps + 1);
+  uint64_t count = 0;
+  uint32_t max = 0;
+
+  void add(uint32_t us) {
+    n[std::min(us / kStepUs, kSteps)]++;
+    count++;
+    max = std::max(max, us);
+  }
+  void merge(const Samples& o) {
+    for (uint32_t i = 0; i <= kSteps; i++) n[i] += o.n[i];
+    count += o.count;
+    max = std::max(max, o.max);
+  }
+  // Upper edge of the step holding the p-th percentile, capped at the maximum.
+  uint32_t pct(uint32_t p) const {
+    if (!count) return 0;
+    uint64_t target = std::max<uint64_t>(1, (count * p + 99) / 100);
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i <= kSteps; i++) {
+      seen += n[i];
+      if (seen >= target) return std::min((i + 1) * kStepUs, max);
+    }
+    return max;
+  }
+};
+
+size_t heapInUse() { return mallinfo2().uordblks; }
+
+// One message a controller is waiting on a reply for.
+struct InFlight {
+  Via via;
+  uint32_t sentUs;
+  char team;         // 'A'/'B' for a point
+  std::string name;  // or the new "ta"/"tb"
+  char nameKey;      // 'a' for ta, 'b' for tb
+};
+
+// What a client believes the state is, rebuilt from state and patch messages.
+struct View {
+  std::string who;
+  bool synced = false;
+  uint32_t seq = 0;
+  int a = 0, b = 0;
+  std::string ta, tb;
+  uint32_t gaps = 0;
+  std::deque<std::pair<uint32_t, uint32_t>> reached;  // (seq, micros) for broadcast latency
+
+  // Returns false when a patch does not follow on, and the client must resync.
+  bool feed(JsonDocument& d, uint32_t nowUs) {
+    const char* type = d["type"] | "";
+    bool patch = !strcmp(type, "patch");
+    if (!patch && strcmp(type, "state")) return true;
+    uint32_t s = d["seq"] | 0u;
+    if (patch) {
+      if (synced && s == seq) return true;  // already have it
+      if (!synced || (d["base"] | 0u) != seq) {
+        gaps++;
+        synced = false;
+        return false;
+      }
+    }
+    JsonObject data = d["data"];
+    if (!patch || data["a"].is<int>()) a = data["a"] | 0;
+    if (!patch || data["b"].is<int>()) b = data["b"] | 0;
+    if (!patch || data["ta"].is<const char*>()) ta = data["ta"] | "";
+    if (!patch || data["tb"].is<const char*>()) tb = data["tb"] | "";
+    seq = s;
+    synced = true;
+    reached.emplace_back(s, nowUs);
+    if (reached.size() > 4096) reached.pop_front();
+    return true;
+  }
+};
+
+// A phone or browser sending updates, each on its own transport.
+struct Controller {
+  Via via = Ble;
+  int index = 0;
+  View view;
+  uint32_t nextId = 1;
+  std::map<std::string, InFlight> pending;  // BLE cid or WebSocket id -> message
+  // BLE
+  uint16_t conn = 0;
+  uint16_t mtu = 0;
+  uint8_t frameId = 0;
+  bleframe::Reassembler rx;
+  // WebSocket
+  AsyncWebSocketClient* wsc = nullptr;
+  // HTTP
+  std::vector<std::pair<AsyncWebServer::Pending, InFlight>> posts;
+
+  size_t inFlight() const { return pending.size() + posts.size(); }
+  bool nameInFlight() const {
+    for (auto& p : pending) if (p.second.nameKey) return true;
+    for (auto& p : posts) if (p.second.nameKey) return true;
+    return false;
+  }
+};
+
+void bleWrite(uint16_t conn, uint16_t mtu, uint8_t id, const std::string& msg) {
+  bleframe::split((const uint8_t*)msg.data(), msg.size(), mtu - 3, id, [&](const uint8_t* p, size_t n) {
+    NimBLEDevice::host::write(conn, kRxChar, p, n);
+    return true;
+  });
+}
+
+class Soak {
+public:
+  explicit Soak(const Config& cfg) : cfg_(cfg) {}
+
+  int run() {
+    connect();
+    t0_ = micros();
+    uint32_t nextCheckpoint = t0_ + kCheckpointUs;
+    uint32_t nextSend = t0_;
+    uint32_t nextRally = t0_;
+    uint32_t nextVandal = t0_;
+    while (micros() - t0_ < cfg_.seconds * 1000000u) {
+      uint32_t now = micros();
+      Profile p = profileAt(now);
+      if (p == Profile::Rally) {
+        if ((int32_t)(now - nextRally) >= 0) {
+          for (auto& c : ctrls_) for (int i = 0; i < 3; i++) sendUpdate(*c);
+          nextRally = now + 1000000;
+        }
+        nextSend = now;
+      } else if ((int32_t)(now - nextSend) >= 0) {
+        // Round-robin across the controllers at the configured rate.
+        for (size_t tries = 0; tries < ctrls_.size(); tries++) {
+          Controller& c = *ctrls_[rr_++ % ctrls_.size()];
+          if (sendUpdate(c)) break;
+        }
+        nextSend += 1000000 / cfg_.rate;
+      }
+      if ((p == Profile::Garbage || p == Profile::Oversize) && (int32_t)(now - nextVandal) >= 0) {
+        // Malformed input comes in bursts; oversized bodies one at a time.
+        if (p == Profile::Garbage) for (int i = 0; i < 10; i++) sendGarbage();
+        else sendOversize();
+        nextVandal = now + (p == Profile::Garbage ? 200000 : 100000);
+      }
+      pollAll();
+      if ((int32_t)(now - nextCheckpoint) >= 0 || nearCap()) {
+        checkpoint();
+        nextCheckpoint = micros() + kCheckpointUs;
+        nextSend = micros();
+      }
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    checkpoint();
+    elapsedUs_ = micros() - t0_;
+    return report();
+  }
+
+private:
+  Profile profileAt(uint32_t now) const {
+    if (cfg_.profile != Profile::Mixed) return cfg_.profile;
+    return (Profile)(((now - t0_) / kPhaseUs) % 4);
+  }
+
+  void connect() {
+    for (int i = 0; i < 3; i++) {
+      auto c = std::make_unique<Controller>();
+      c->via = Ble;
+      c->conn = 1 + i;
+      c->mtu = i == 0 ? 23 : 185;  // one central without an MTU exchange
+      NimBLEDevice::host::connect(c->conn, c->mtu);
+      NimBLEDevice::host::subscribe(c->conn, kTxChar);
+      ctrls_.push_back(std::move(c));
+    }
+    for (int i = 0; i < 4; i++) {
+      auto c = std::make_unique<Controller>();
+      c->via = Ws;
+      c->wsc = ws.hostConnect();
+      ctrls_.push_back(std::move(c));
+    }
+    for (int i = 0; i < 3; i++) {
+      auto c = std::make_unique<Controller>();
+      c->via = Http;
+      ctrls_.push_back(std::move(c));
+    }
+    for (size_t i = 0; i < ctrls_.size(); i++) {
+      Controller& c = *ctrls_[i];
+      c.index = (int)i;
+      c.view.who = std::string(kViaName[c.via]) + " controller " + std::to_string(i);
+    }
+    for (int i = 0; i < 2; i++) {
+      sse_[i].client = events.hostConnect();
+      sse_[i].view.who = "sse listener " + std::to_string(i);
+    }
+    wsListener_.via = Ws;
+    wsListener_.index = -1;
+    wsListener_.view.who = "ws listener";
+    wsListener_.wsc = ws.hostConnect();
+    vandalBle_ = 4;
+    NimBLEDevice::host::connect(vandalBle_, 185);
+    NimBLEDevice::host::subscribe(vandalBle_, kTxChar);
+    vandalWs_ = ws.hostConnect();
+    // Let everyone receive their first full state.
+    uint32_t until = micros() + 2000000;
+    while (micros() < until && !allSynced()) {
+      pollAll();
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  // ---- Controller traffic ----
+
+  bool sendUpdate(Controller& c) {
+    if (c.inFlight() >= kMaxInFlight) return false;
+    InFlight f{ c.via, micros(), 0, std::string(), 0 };
+    JsonDocument d;
+    // HTTP controller 7 renames team A with full-state fields, WebSocket
+    // controller 3 renames team B with patches; everything else scores.
+    bool namer = (c.index == 7 || c.index == 3) && !c.nameInFlight() && ++names_ % 5 == 0;
+    if (namer && c.index == 7) {
+      f.name = "Home " + std::to_string(names_);
+      f.nameKey = 'a';
+      d["type"] = "state";
+      d["data"]["ta"] = f.name;
+    } else if (namer && c.view.synced) {
+      f.name = "Away " + std::to_string(names_);
+      f.nameKey = 'b';
+      d["type"] = "patch";
+      d["base"] = c.view.seq;
+      d["data"]["tb"] = f.name;
+    } else {
+      char team = (points_++ & 1) ? 'B' : 'A';
+      if (model_.score(team) + inFlightPoints(team) >= kScoreCap) team = team == 'A' ? 'B' : 'A';
+      if (model_.score(team) + inFlightPoints(team) >= kScoreCap) return false;
+      f.team = team;
+      d["type"] = "cmd";
+      d["op"] = "point";
+      d["team"] = team == 'A' ? "A" : "B";
+      d["ts"] = (uint64_t)1700000000000ull + millis();
+    }
+    std::string key = std::to_string(c.nextId++);
+    std::string body;
+    stats_.sent[c.via]++;
+    if (c.via == Ble) {
+      // BLE only answers a change that carries a cid (after it is drawn and sent).
+      key = "s" + std::to_string(c.index) + "-" + key;
+      d["cid"] = key;
+      serializeJson(d, body);
+      c.pending[key] = f;
+      bleWrite(c.conn, c.mtu, c.frameId++, body);
+    } else if (c.via == Ws) {
+      d["id"] = (uint32_t)atol(key.c_str());
+      serializeJson(d, body);
+      c.pending[key] = f;
+      drainWs(c);
+      ws.hostSend(c.wsc, body);
+      // A full queue is refused synchronously, before any other reply.
+      drainWs(c, &key);
+    } else {
+      serializeJson(d, body);
+      c.posts.emplace_back(server.start(HTTP_POST, "/api/v1/scoreboard", body, kJson), f);
+    }
+    return true;
+  }
+
+  int inFlightPoints(char team) const {
+    int n = 0;
+    for (auto& c : ctrls_) {
+      for (auto& p : c->pending) n += p.second.team == team;
+      for (auto& p : c->posts) n += p.second.team == team;
+    }
+    return n;
+  }
+
+  bool nearCap() const {
+    return model_.a + inFlightPoints('A') >= kScoreCap && model_.b + inFlightPoints('B') >= kScoreCap;
+  }
+
+  // A controller's message was answered.
+  void settle(Controller& c, const InFlight& f, JsonDocument& reply) {
+    uint32_t now = micros();
+    const char* type = reply["type"] | "";
+    if (!strcmp(type, "ack")) {
+      stats_.acked[f.via]++;
+      stats_.ack[f.via].add(now - f.sentUs);
+      if (f.team) (f.team == 'A' ? model_.a : model_.b)++;
+      if (f.nameKey) (f.nameKey == 'a' ? model_.ta : model_.tb) = f.name;
+      uint32_t seq = reply["data"]["seq"] | 0u;
+      waiting_.push_back({ f.via, f.sentUs, seq });
+    } else if (!strcmp(reply["data"]["code"] | "", "busy")) {
+      stats_.busy[f.via]++;
+    } else {
+      stats_.refused[f.via]++;
+      model_.uncertain = true;  // a refused state/patch may still have applied part of itself
+      Serial.printf("[SOAK] %s: valid message refused: %s\n", c.view.who.c_str(), reply["data"]["msg"] | "?");
+    }
+  }
+
+  // Feeds a message to the client's view; resyncs it if a patch did not follow on.
+  void observe(View& v, JsonDocument& d, Controller* resync) {
+    if (v.feed(d, micros()) || !resync) return;
+    Serial.printf("[SOAK] %s: patch gap at v%u, resyncing\n", v.who.c_str(), (unsigned)v.seq);
+    if (resync->via == Ble) bleWrite(resync->conn, resync->mtu, resync->frameId++, "{\"type\":\"resync\"}");
+    else ws.hostSend(resync->wsc, "{\"type\":\"resync\"}");
+  }
+
+  // ---- Vandals ----
+
+  void sendGarbage() {
+    static const char* const kBad[] = {
+      "{nope", "[1,2", "{\"type\":\"cmd\",\"op\":\"explode\",\"team\":\"A\"}",
+      "{\"type\":\"cmd\",\"op\":\"point\",\"team\":\"Z\"}", "{\"type\":\"patch\",\"base\":4000000000,\"data\":{\"a\":1}}",
+      "{\"type\":\"cmd\",\"op\":\"point\",\"team\":\"A\"",
+    };
+    std::string bad = kBad[garbage_++ % (sizeof(kBad) / sizeof(kBad[0]))];
+    vandalPosts_.emplace_back(server.start(HTTP_POST, "/api/v1/scoreboard", bad, kJson));
+    ws.hostSend(vandalWs_, bad);
+    ws.hostSend(vandalWs_, std::string("\xc1\xc1\xc1", 3), true);  // not MessagePack either
+    stats_.vandalWsSent += 2;
+    stats_.vandalHttpSent++;
+    // BLE: a whole message that does not parse (an unclosed brace would hold
+    // the unframed reassembler open), then a fragment out of order.
+    if (std::count(bad.begin(), bad.end(), '{') == std::count(bad.begin(), bad.end(), '}')) {
+      NimBLEDevice::host::write(vandalBle_, kRxChar, (const uint8_t*)bad.data(), bad.size());
+      stats_.vandalBleSent++;
+    }
+    uint8_t frag[8] = { bleframe::kMagic, (uint8_t)garbage_, 1, 3, '{', '}', ' ', ' ' };
+    NimBLEDevice::host::write(vandalBle_, kRxChar, frag, sizeof(frag));
+    stats_.vandalBleSent++;
+  }
+
+  void sendOversize() {
+    std::string big = "{\"type\":\"state\",\"data\":{\"ta\":\"" + std::string(kOversize, 'x') + "\"}}";
+    vandalPosts_.emplace_back(server.start(HTTP_POST, "/api/v1/scoreboard", big, kJson));
+    ws.hostSend(vandalWs_, big, false, 4);
+    bleWrite(vandalBle_, 185, 0x80 | (oversize_++ & 0x7f), big);
+    stats_.vandalHttpSent++;
+    stats_.vandalWsSent++;
+    stats_.vandalBleSent++;
+  }
+
+  // ---- Polling ----
+
+  void pollAll() {
+    uint32_t now = micros();
+    for (auto& cp : ctrls_) {
+      Controller& c = *cp;
+      if (c.via == Ble) pollBle(c);
+      else if (c.via == Ws) drainWs(c);
+      else pollHttp(c);
+      // Nothing came back in time: lost. The score can no longer be checked
+      // until the next checkpoint rebases it.
+      for (auto it = c.pending.begin(); it != c.pending.end();) {
+        if (now - it->second.sentUs < kLostUs) { ++it; continue; }
+        stats_.lost[c.via]++;
+        model_.uncertain = true;
+        it = c.pending.erase(it);
+      }
+    }
+    for (auto& s : sse_) pollSse(s);
+    drainWs(wsListener_);
+    for (auto& n : NimBLEDevice::host::take(vandalBle_)) {
+      if (vandalRx_.feed(n.data(), n.size(), millis()) != bleframe::Reassembler::Complete) continue;
+      std::string m((const char*)vandalRx_.data(), vandalRx_.size());
+      if (m.find("\"type\":\"error\"") != std::string::npos) stats_.vandalBleRefused++;
+    }
+    for (auto& m : vandalWs_->take()) {
+      JsonDocument d;
+      if (m.binary ? deserializeMsgPack(d, m.data) : deserializeJson(d, m.data)) continue;
+      const char* type = d["type"] | "";
+      if (!strcmp(type, "error")) stats_.vandalWsRefused++;
+      else if (!strcmp(type, "ack")) stats_.vandalAccepted++;
+    }
+    for (auto it = vandalPosts_.begin(); it != vandalPosts_.end();) {
+      if (!it->poll()) { ++it; continue; }
+      if (it->result.code == 400 || it->result.code == 409 || it->result.code == 413) stats_.vandalHttpRefused++;
+      else if (it->result.code == 200) stats_.vandalAccepted++;
+      it = vandalPosts_.erase(it);
+    }
+    // Broadcast latency: until the first SSE listener has the acked version.
+    View& ref = sse_[0].view;
+    for (auto it = waiting_.begin(); it != waiting_.end();) {
+      auto r = std::find_if(ref.reached.begin(), ref.reached.end(),
+                            [&](const std::pair<uint32_t, uint32_t>& x) { return x.first >= it->seq; });
+      if (r == ref.reached.end()) { ++it; continue; }
+      stats_.bcast[it->via].add(r->second - it->sentUs);
+      it = waiting_.erase(it);
+    }
+  }
+
+  void pollBle(Controller& c) {
+    for (auto& n : NimBLEDevice::host::take(c.conn)) {
+      if (c.rx.feed(n.data(), n.size(), millis()) != bleframe::Reassembler::Complete) continue;
+      JsonDocument d;
+      if (deserializeJson(d, (const char*)c.rx.data(), c.rx.size())) {
+        stats_.badReplies++;
+        continue;
+      }
+      handleReply(c, d, d["cid"] | "");
+    }
+  }
+
+  // `busyKey`: a "busy" error without an id answers that message.
+  void drainWs(Controller& c, const std::string* busyKey = nullptr) {
+    for (auto& m : c.wsc->take()) {
+      JsonDocument d;
+      if (deserializeJson(d, m.data)) {
+        stats_.badReplies++;
+        continue;
+      }
+      std::string key = d["id"].is<uint32_t>() ? std::to_string(d["id"].as<uint32_t>()) : std::string();
+      if (key.empty() && busyKey && !strcmp(d["data"]["code"] | "", "busy")) key = *busyKey;
+      handleReply(c, d, key);
+    }
+  }
+
+  void handleReply(Controller& c, JsonDocument& d, const std::string& key) {
+    const char* type = d["type"] | "";
+    if (!strcmp(type, "ack") || !strcmp(type, "error")) {
+      auto it = key.empty() ? c.pending.end() : c.pending.find(key);
+      if (it != c.pending.end()) {
+        InFlight f = it->second;
+        c.pending.erase(it);
+        settle(c, f, d);
+      } else if (!strcmp(d["data"]["code"] | "", "busy")) {
+        // BLE refuses from the write callback but the reply is queued behind
+        // others, so it cannot be matched to a message.
+        stats_.busy[c.via]++;
+        model_.uncertain = true;
+      }
+      return;
+    }
+    observe(c.view, d, &c);
+  }
+
+  void pollHttp(Controller& c) {
+    for (auto it = c.posts.begin(); it != c.posts.end();) {
+      bool lost = micros() - it->second.sentUs >= kLostUs;
+      if (!it->first.poll() && !lost) { ++it; continue; }
+      if (!it->first.result.code) {
+        it->first.drop();
+        stats_.lost[Http]++;
+        model_.uncertain = true;
+      } else {
+        JsonDocument d;
+        if (deserializeJson(d, it->first.result.body)) stats_.badReplies++;
+        else if (it->first.result.code == 503) stats_.busy[Http]++;
+        else settle(c, it->second, d);
+      }
+      it = c.posts.erase(it);
+    }
+  }
+
+  struct SseListener {
+    AsyncEventSourceClient* client = nullptr;
+    uint32_t lastId = 0;  // id of the last event the view took
+    View view;
+  };
+
+  void pollSse(SseListener& s) {
+    for (auto& e : s.client->take()) {
+      JsonDocument d;
+      if (deserializeJson(d, e.data)) {
+        stats_.badReplies++;
+        continue;
+      }
+      if (s.view.feed(d, micros())) {
+        s.lastId = e.id;
+        continue;
+      }
+      // EventSource reconnects with the last id it saw.
+      Serial.printf("[SOAK] %s: patch gap at v%u, reconnecting\n", s.view.who.c_str(), (unsigned)s.view.seq);
+      events.hostDisconnect(s.client);
+      s.client = events.hostConnect(s.lastId);
+      s.view.synced = false;
+    }
+  }
+
+  // Everyone who receives broadcasts (HTTP posters only get their replies).
+  std::vector<View*> views() {
+    std::vector<View*> v;
+    for (auto& c : ctrls_) if (c->via != Http) v.push_back(&c->view);
+    for (auto& s : sse_) v.push_back(&s.view);
+    v.push_back(&wsListener_.view);
+    return v;
+  }
+
+  // seq 0: everyone has some state; otherwise everyone is at exactly `seq`.
+  bool allSynced(uint32_t seq = 0) {
+    for (View* v : views()) if (!v->synced || (seq && v->seq != seq)) return false;
+    return true;
+  }
+
+  // ---- Checkpoints ----
+
+  struct Truth {
+    uint32_t seq = 0;
+    int a = 0, b = 0;
+    std::string ta, tb;
+  };
+
+  bool fetchState(Truth& t) {
+    auto r = server.request(HTTP_GET, "/api/v1/state");
+    JsonDocument d;
+    if (r.code != 200 || deserializeJson(d, r.body)) return false;
+    t.seq = d["seq"] | 0u;
+    t.a = d["data"]["a"] | 0;
+    t.b = d["data"]["b"] | 0;
+    t.ta = d["data"]["ta"] | "";
+    t.tb = d["data"]["tb"] | "";
+    return true;
+  }
+
+  void checkpoint() {
+    uint32_t pause = micros();
+    // Quiesce: every controller message answered (or lost), the update queue
+    // drained, the display and network sinks caught up.
+    while (micros() - pause < kLostUs + 500000) {
+      pollAll();
+      bool idle = true;
+      for (auto& c : ctrls_) idle &= c->inFlight() == 0;
+      if (idle) break;
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    Truth t;
+    bool got = false;
+    uint32_t until = micros() + 2000000;
+    do {
+      pollAll();
+      got = fetchState(t);
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    } while ((!got || !allSynced(t.seq)) && micros() < until);
+    pollAll();
+    stats_.checkpoints++;
+    if (!got) {
+      Serial.printf("[SOAK] checkpoint %u: GET /api/v1/state failed\n", (unsigned)stats_.checkpoints);
+      stats_.mismatches++;
+      return;
+    }
+    // Every listener agrees with the device.
+    for (View* v : views()) {
+      if (v->synced && v->seq == t.seq && v->a == t.a && v->b == t.b && v->ta == t.ta && v->tb == t.tb) continue;
+      stats_.mismatches++;
+      Serial.printf("[SOAK] checkpoint %u: %s has v%u %d-%d \"%s\"/\"%s\"%s, device v%u %d-%d \"%s\"/\"%s\"\n",
+        (unsigned)stats_.checkpoints, v->who.c_str(), (unsigned)v->seq, v->a, v->b, v->ta.c_str(), v->tb.c_str(),
+        v->synced ? "" : " (unsynced)", (unsigned)t.seq, t.a, t.b, t.ta.c_str(), t.tb.c_str());
+    }
+    // The device applied exactly what it acknowledged.
+    if (model_.uncertain) {
+      stats_.unverified++;
+    } else if (model_.a != t.a || model_.b != t.b || model_.ta != t.ta || model_.tb != t.tb) {
+      stats_.mismatches++;
+      Serial.printf("[SOAK] checkpoint %u: acked %d-%d \"%s\"/\"%s\", device %d-%d \"%s\"/\"%s\"\n",
+        (unsigned)stats_.checkpoints, model_.a, model_.b, model_.ta.c_str(), model_.tb.c_str(),
+        t.a, t.b, t.ta.c_str(), t.tb.c_str());
+    }
+    model_ = Model{ t.a, t.b, t.ta, t.tb, false };
+    if (t.a >= kScoreCap / 2 || t.b >= kScoreCap / 2) {
+      auto r = server.request(HTTP_POST, "/api/v1/scoreboard", "{\"type\":\"state\",\"data\":{\"a\":0,\"b\":0}}", kJson);
+      if (r.code == 200) model_.a = model_.b = 0;
+      else model_.uncertain = true;
+    }
+    size_t heap = heapInUse();
+    if (!stats_.heapStart) stats_.heapStart = heap;
+    stats_.heapEnd = heap;
+    stats_.heapPeak = std::max(stats_.heapPeak, heap);
+    pausedUs_ += micros() - pause;
+  }
+
+  // ---- Report ----
+
+  int report() {
+    uint32_t sent = 0, acked = 0, busy = 0, lost = 0, refused = 0;
+    double secs = elapsedUs_ / 1e6;
+    Serial.printf("[SOAK] profile %s, %.0f s (%.1f s in checkpoints), 10 controllers (3 BLE, 4 WS, 3 HTTP), %u updates/s offered\n",
+      kProfileName[(int)cfg_.profile], secs, pausedUs_ / 1e6, (unsigned)cfg_.rate);
+    for (int v = 0; v < kVias; v++) {
+      Samples& a = stats_.ack[v];
+      Samples& b = stats_.bcast[v];
+      Serial.printf("[SOAK] %-4s sent %6u acked %6u busy %4u refused %3u lost %3u | ack p50 %6u p99 %6u max %7u us"
+                    " | broadcast p50 %6u p99 %6u max %7u us\n",
+        kViaName[v], (unsigned)stats_.sent[v], (unsigned)stats_.acked[v], (unsigned)stats_.busy[v],
+        (unsigned)stats_.refused[v], (unsigned)stats_.lost[v], (unsigned)a.pct(50), (unsigned)a.pct(99), (unsigned)a.max,
+        (unsigned)b.pct(50), (unsigned)b.pct(99), (unsigned)b.max);
+      sent += stats_.sent[v];
+      acked += stats_.acked[v];
+      busy += stats_.busy[v];
+      lost += stats_.lost[v];
+      refused += stats_.refused[v];
+      all_.merge(b);
+    }
+    Serial.printf("[SOAK] throughput %.1f acked/s of %.1f sent/s; broadcast p50 %u p99 %u max %u us\n",
+      acked / secs, sent / secs, (unsigned)all_.pct(50), (unsigned)all_.pct(99), (unsigned)all_.max);
+    Serial.printf("[SOAK] vandals: http %u/%u refused, ws %u/%u, ble %u/%u; %u accepted; %u unreadable replies\n",
+      (unsigned)stats_.vandalHttpRefused, (unsigned)stats_.vandalHttpSent, (unsigned)stats_.vandalWsRefused,
+      (unsigned)stats_.vandalWsSent, (unsigned)stats_.vandalBleRefused, (unsigned)stats_.vandalBleSent,
+      (unsigned)stats_.vandalAccepted, (unsigned)stats_.badReplies);
+    long growth = (long)stats_.heapEnd - (long)stats_.heapStart;
+    Serial.printf("[SOAK] heap in use %u KB at the first checkpoint, %u KB at the last (%+ld KB), peak %u KB\n",
+      (unsigned)(stats_.heapStart / 1024), (unsigned)(stats_.heapEnd / 1024), growth / 1024, (unsigned)(stats_.heapPeak / 1024));
+    uint32_t gaps = 0;
+    for (View* v : views()) gaps += v->gaps;
+    Serial.printf("[SOAK] %u checkpoints (%u unverified), %u mismatches, %u patch gaps\n",
+      (unsigned)stats_.checkpoints, (unsigned)stats_.unverified, (unsigned)stats_.mismatches, (unsigned)gaps);
+
+    int failed = 0;
+    auto gate = [&](bool ok, const char* what) {
+      Serial.printf("[SOAK] %s %s\n", ok ? "pass" : "FAIL", what);
+      if (!ok) failed++;
+    };
+    gate(stats_.mismatches == 0 && gaps == 0, "state consistent: device, acks and every listener agree, no gaps");
+    gate(lost == 0 && stats_.badReplies == 0, "every controller message answered with a readable reply");
+    gate(refused == 0 && busy * 100 <= sent, "valid messages accepted (busy at most 1%)");
+    gate(acked > 0 && all_.pct(99) <= cfg_.p99Ms * 1000, "broadcast p99 within SOAK_P99_MS");
+    gate(stats_.vandalAccepted == 0 && stats_.vandalHttpRefused == stats_.vandalHttpSent &&
+         stats_.vandalWsRefused == stats_.vandalWsSent && stats_.vandalBleRefused >= stats_.vandalBleSent,
+         "every malformed or oversized message refused");
+    gate(growth <= (long)cfg_.maxGrowthKb * 1024, "heap growth within SOAK_MAX_GROWTH_KB");
+    auto ping = server.request(HTTP_GET, "/api/v1/ping");
+    gate(ping.code == 200, "still answering after the soak");
+    Serial.printf("[SOAK] %d gate(s) failed\n", failed);
+    return failed;
+  }
+
+  struct Model {
+    int a = 0, b = 0;
+    std::string ta, tb;
+    bool uncertain = true;  // until the first checkpoint
+    int score(char team) const { return team == 'A' ? a : b; }
+  };
+
+  struct Waiting {
+    Via via;
+    uint32_t sentUs;
+    uint32_t seq;
+  };
+
+  struct Stats {
+    uint32_t sent[kVias] = {}, acked[kVias] = {}, busy[kVias] = {}, refused[kVias] = {}, lost[kVias] = {};
+    Samples ack[kVias], bcast[kVias];
+    uint32_t vandalHttpSent = 0, vandalHttpRefused = 0, vandalWsSent = 0, vandalWsRefused = 0;
+    uint32_t vandalBleSent = 0, vandalBleRefused = 0, vandalAccepted = 0, badReplies = 0;
+    uint32_t checkpoints = 0, unverified = 0, mismatches = 0;
+    size_t heapStart = 0, heapEnd = 0, heapPeak = 0;
+  };
+
+  Config cfg_;
+  std::vector<std::unique_ptr<Controller>> ctrls_;
+  SseListener sse_[2];
+  Controller wsListener_;
+  uint16_t vandalBle_ = 0;
+  bleframe::Reassembler vandalRx_;
+  AsyncWebSocketClient* vandalWs_ = nullptr;
+  std::vector<AsyncWebServer::Pending> vandalPosts_;
+  std::vector<Waiting> waiting_;
+  Model model_;
+  Stats stats_;
+  Samples all_;
+  uint32_t t0_ = 0, elapsedUs_ = 0, pausedUs_ = 0;
+  uint32_t rr_ = 0, points_ = 0, names_ = 0, garbage_ = 0, oversize_ = 0;
+};
+} // namespace
+
+// Called by host_main after setup(). The clients run on their own thread, as
+// the phones and browsers would; this thread keeps running loop().
+int runSoak() {
+  Config cfg;
+  cfg.load();
+  std::atomic<bool> done{ false };
+  int failed = 0;
+  std::thread clients([&] {
+    Soak soak(cfg);
+    failed = soak.run();
+    done = true;
+  });
+  while (!done) loop();
+  clients.join();
+  return failed;
+}
+#endif
@@ -8,7 +8,23 @@
 #include <ESPAsyncWebServer.h>       // CHANGED: same header name; using maintained fork via platformio.ini
 #include <NimBLEDevice.h>
 #include <ArduinoJson.h>
+#include <memory>
 #include "display.h"
+#include "codec.h"
+#include "ble_frame.h"
+#include "scoring.h"
+#include "journal.h"
+#include "sink.h"
+#include "seqlock.h"
+#include "mpsc_queue.h"
+#include "replay.h"
+#include "metrics.h"
+#include "trace.h"
+#ifdef HOT_PATH_BENCH
+#include "bench.h"
+#endif
+#include <vector>
+#include <deque>
 
 // ---- Config ----
 #ifndef GH_PAGES_ORIGIN
@@ -20,6 +36,23 @@
 #ifndef SOFTAP_PASS
 #define SOFTAP_PASS "volley123"
 #endif
+#ifndef DISPLAY_MAX_FPS
+#define DISPLAY_MAX_FPS 30
+#endif
+#ifndef SSE_MAX_HZ
+#define SSE_MAX_HZ 10
+#endif
+#ifndef SSE_MAX_CLIENTS
+#define SSE_MAX_CLIENTS 8
+#endif
+#ifndef WS_MAX_HZ
+#define WS_MAX_HZ 50
+#endif
+
+// Networking (WiFi, AsyncTCP, NimBLE host, state owner, BLE/SSE sinks, journal)
+// runs on the PRO core; loop() and with it rendering stays on the APP core.
+constexpr BaseType_t kNetCore = 0;
+constexpr BaseType_t kRenderCore = ARDUINO_RUNNING_CORE;
 
 // BLE UUIDs (Nordic UART style)
 static NimBLEUUID SERVICE_UUID("6e400001-b5a3-f393-e0a9-e50e24dcca9e");
@@ -29,94 +62,309 @@ static NimBLEUUID TX_CHAR_UUID("6e400003-b5a3-f393-e0a9-e50e24dcca9e"); // notif
 // Globals
 AsyncWebServer server(80);
 AsyncEventSource events("/api/v1/events");
+AsyncWebSocket ws("/api/v1/ws");
 DisplayRenderer* renderer = makeRenderer();
+metrics::Registry gMetrics;  // always on; see GET /api/v1/metrics
 
 // Shared state
+// S has a single writer, the state-owner task: transports only queue raw
+// messages (see submitUpdate). After each batch the owner publishes S through a
+// seqlock; every other task reads the published copy and never blocks it.
 ScoreboardState S;
-SemaphoreHandle_t stateMutex;
+// Bumped by the owner once per applied batch. Consumers compare versions
+// instead of payloads; the serialized snapshot is rebuilt at most once per version.
+uint32_t gStateVersion = 1;
+// Random per boot (set in setup()). Versions restart at 1 after a reboot, so a
+// version a client kept from before it is only trusted alongside a matching id.
+uint32_t gBootId = 0;
+struct PublishedState {
+  ScoreboardState st;
+  uint32_t version;
+};
+SeqLock<PublishedState> gPublished;
+scoring::History<16> gHistory;  // undo/redo for scoring commands, owner task only
+journal::Journal gJournal;
+SemaphoreHandle_t snapshotMutex;
+std::shared_ptr<const String> gSnapshot;
+std::shared_ptr<const std::string> gSnapshotMsgpack;  // same version as gSnapshot
+uint32_t gSnapshotVersion = 0;
 
 // BLE
+// Several centrals may be connected at once (head ref, scorekeeper, a coach's
+// tablet); each one gets a BleLink slot. The NimBLE host task claims and frees
+// slots and owns the reassembler; replies are queued on the slot's outbox; only
+// the BLE sink task transmits, per connection, so a slow central only delays
+// itself.
+constexpr size_t kMaxBleLinks = CONFIG_BT_NIMBLE_MAX_CONNECTIONS;
+constexpr size_t kBleOutboxMax = 8;     // queued replies per central; the oldest is dropped
+constexpr size_t kBleBacklogMax = 64;   // queued fragments per central before replies are dropped
+constexpr uint32_t kBleStallMs = 2000;  // no notify accepted for this long: drop the backlog
+constexpr uint32_t kBleStatsLogMs = 5000;  // per-central tx summary in the serial log
 NimBLEServer* pServer = nullptr;
 NimBLECharacteristic* pTx = nullptr;
 NimBLECharacteristic* pRx = nullptr;
-std::string bleRxBuffer;
-volatile bool gPendingBroadcast = false;
+struct BleTxStats {
+  uint32_t messages = 0;
+  uint32_t fragments = 0;
+  uint32_t bytes = 0;
+  uint32_t retries = 0;    // notify refused (controller busy), retried after a pause
+  uint32_t failures = 0;   // backlog dropped after a stall
+  uint32_t dropped = 0;    // replies dropped, outbox or backlog full
+  uint32_t windowStartMs = 0;
+  uint32_t windowBytes = 0;
+  uint32_t bytesPerSec = 0;
+};
+struct BleLink {
+  // Guarded by bleLinksMutex.
+  uint16_t conn = BLE_HS_CONN_HANDLE_NONE;  // NONE: free slot
+  uint32_t id = 0;                 // unique per connection, so replies never reach a later central
+  uint16_t mtu = 23;               // negotiated ATT MTU; notifications carry MTU-3 bytes
+  bool subscribed = false;         // notifications enabled on TX
+  Codec codec = Codec::Json;       // negotiated in hello
+  std::vector<std::string> outbox; // replies, drained by the BLE sink task
+  // NimBLE host task only.
+  bleframe::Reassembler rx;
+  // Written by the BLE sink task (interval by the host task), read racily by /api/v1/sinks.
+  SinkGate gate{"ble", 30};        // re-tuned to this connection's interval
+  volatile uint32_t backlog = 0;   // fragments waiting to be sent
+  BleTxStats tx;
+  BleTxStats txLogged;             // tx at the last serial summary
+};
+SemaphoreHandle_t bleLinksMutex;
+BleLink gBleLinks[kMaxBleLinks];
+uint32_t gBleLinkIds = 0;
+// Sinks: each consumer of state versions runs at its own pace (see sink.h).
+// Display and the HTTP snapshot run in loop(); BLE and SSE have their own tasks,
+// and every BLE central has its own gate (BleLink::gate).
+SinkGate gDisplaySink("display", 1000 / DISPLAY_MAX_FPS);
+SinkGate gSnapshotSink("http", 0);
+SinkGate gSseSink("sse", 1000 / SSE_MAX_HZ);
+SinkGate gWsSink("ws", 1000 / WS_MAX_HZ);
+TaskHandle_t bleSinkTask = nullptr;
+TaskHandle_t sseSinkTask = nullptr;
+TaskHandle_t wsSinkTask = nullptr;
+// SSE clients are sent updates one by one, each tagged with its state version
+// as the event id. A client whose send queue is full skips versions and later
+// gets one full state instead of a pile of superseded patches; a client that
+// reconnects with Last-Event-ID is replayed the patches it missed.
+constexpr size_t kSseMaxClients = SSE_MAX_CLIENTS;
+constexpr size_t kSseMaxQueued = 4;               // messages queued for a client before it skips
+constexpr uint32_t kSseMinFreeHeap = 40 * 1024;   // refuse new clients below this
+constexpr uint32_t kLagRetryMs = 250;             // how often lagging SSE/WS clients are retried
+struct SseClient {
+  AsyncEventSourceClient* client;
+  uint32_t id;
+  uint32_t version = 0;   // last version queued to it
+  uint32_t skipped = 0;   // sink runs skipped because its queue was full
+  uint32_t replayed = 0;  // patches replayed on reconnect
+};
+SemaphoreHandle_t sseMutex;  // gSseClients, gSseReplay
+std::vector<SseClient> gSseClients;
+uint32_t gSseClientIds = 0;
+ReplayRing gSseReplay(32, 8 * 1024);
+// SSE event ids come back as Last-Event-ID, which the server library parses as
+// an int, so an id is 31 bits: a 16-bit tag of the boot over the low 15 bits of
+// the version. The replay ring spans a few dozen versions, far inside 2^15.
+constexpr uint32_t kSseVersionBits = 15;
+constexpr uint32_t kSseVersionMask = (1u << kSseVersionBits) - 1;
+uint32_t sseBootTag() { return 1 + gBootId % 0xffff; }
+uint32_t sseEventId(uint32_t version) {
+  return (sseBootTag() << kSseVersionBits) | (version & kSseVersionMask);
+}
+// The version behind an id this boot sent, widened to the latest one at or
+// below `newest`; 0 for no id or one from another boot, which gets the full state.
+uint32_t sseVersionOf(uint32_t id, uint32_t newest) {
+  if (!id || id >> kSseVersionBits != sseBootTag()) return 0;
+  uint32_t v = (newest & ~kSseVersionMask) | (id & kSseVersionMask);
+  if (v <= newest) return v;
+  return newest > kSseVersionMask ? v - (kSseVersionMask + 1) : 0;
+}
+struct SseStats {
+  uint32_t replays = 0;       // reconnects served from the ring
+  uint32_t replayMisses = 0;  // reconnects too old for the ring: full state
+  uint32_t refused = 0;       // connections refused (client limit or low heap)
+} gSseStats;
+// WebSocket clients carry requests and replies on the same connection and
+// follow the patch chain like SSE clients (see deliverToClients).
+struct HttpBody;
+struct WsClient {
+  uint32_t id;                  // AsyncWebSocketClient::id()
+  uint32_t version = 0;         // last version queued to it
+  uint32_t skipped = 0;         // sink runs skipped because its queue was full
+  HttpBody* partial = nullptr;  // a message still arriving in pieces (AsyncTCP task only)
+};
+SemaphoreHandle_t wsMutex;  // gWsClients
+std::vector<WsClient> gWsClients;
 
 // Forward decl
-String stateToJson();
-bool updateStateFromJson(const String& jsonStr, String* errorMsg);
-void broadcastState();
+std::shared_ptr<const String> stateSnapshot(uint32_t* versionOut = nullptr,
+                                            std::shared_ptr<const std::string>* msgpackOut = nullptr);
+struct MessageResult;
+bool updateStateFromJson(const uint8_t* data, size_t len, MessageResult& res);
 void scheduleBroadcast();
 
 // ---- Utilities ----
-void withState(std::function<void(ScoreboardState&)> fn) {
-  xSemaphoreTake(stateMutex, portMAX_DELAY);
-  fn(S);
-  xSemaphoreGive(stateMutex);
+static void addLogs(JsonArray arr, const ScoreboardState::LogEntry* items, int from, int to) {
+  for (int i=from; i<to; i++) {
+    JsonObject e = arr.add<JsonObject>();
+    e["reason"] = items[i].reason;
+    e["scorer"] = items[i].scorer;
+    e["ts"] = items[i].ts;
+  }
 }
 
-String stateToJson() {
-  JsonDocument doc;                                   // CHANGED: use JsonDocument (ArduinoJson v7)
-  doc["type"] = "state";
-  JsonObject data = doc["data"].to<JsonObject>();     // CHANGED: create nested object per v7
-  xSemaphoreTake(stateMutex, portMAX_DELAY);
-  data["ta"] = S.ta;
-  data["tb"] = S.tb;
-  data["ca"] = S.ca;
-  data["cb"] = S.cb;
-  data["abg"] = S.abg;
-  data["bbg"] = S.bbg;
-  data["a"] = S.a;
-  data["b"] = S.b;
-  data["sv"] = String(S.sv);
-  data["set"] = S.set;
-  data["ma"] = S.ma;
-  data["mb"] = S.mb;
-  data["bo"] = S.bo;
-  data["ble"] = S.ble;
+// Number of entries appended to `prev` to get `cur` once trimmed to the last 4,
+// or 0 if `cur` is not such a tail (then the whole list has to be sent).
+static int appendedLogs(const ScoreboardState::LogEntry* prev, uint8_t pn,
+                        const ScoreboardState::LogEntry* cur, uint8_t cn) {
+  for (int k=1; k<=cn; k++) {
+    int kept = cn - k;
+    if (cn != min(4, pn + k) || kept > pn) continue;
+    bool match = true;
+    for (int j=0; j<kept && match; j++) match = prev[pn - kept + j] == cur[j];
+    if (match) return k;
+  }
+  return 0;
+}
+
+static void writeLogs(JsonObject data, const char* key, const char* appendKey,
+                      const ScoreboardState::LogEntry* cur, uint8_t cn,
+                      const ScoreboardState::LogEntry* prev, uint8_t pn, bool delta) {
+  if (delta) {
+    bool same = cn == pn;
+    for (int i=0; i<cn && same; i++) same = cur[i] == prev[i];
+    if (same) return;
+    int k = appendedLogs(prev, pn, cur, cn);
+    if (k > 0) { addLogs(data[appendKey].to<JsonArray>(), cur, cn - k, cn); return; }
+  }
+  addLogs(data[key].to<JsonArray>(), cur, 0, cn);
+}
+
+// Write the fields of `s` into `data`. With a `prev` state only the fields that
+// differ are written (a patch); rotations go as whole arrays, logs that only
+// grew at the tail go as "la+"/"lb+" appends.
+void writeStateFields(JsonObject data, const ScoreboardState& s, const ScoreboardState* prev) {
+  const bool d = prev != nullptr;
+  if (!d || strcmp(s.ta, prev->ta) != 0) data["ta"] = s.ta;
+  if (!d || strcmp(s.tb, prev->tb) != 0) data["tb"] = s.tb;
+  if (!d || s.ca != prev->ca) data["ca"] = s.ca.hex;
+  if (!d || s.cb != prev->cb) data["cb"] = s.cb.hex;
+  if (!d || s.abg != prev->abg) data["abg"] = s.abg.hex;
+  if (!d || s.bbg != prev->bbg) data["bbg"] = s.bbg.hex;
+  if (!d || s.a != prev->a) data["a"] = s.a;
+  if (!d || s.b != prev->b) data["b"] = s.b;
+  if (!d || s.sv != prev->sv) { char sv[2] = { s.sv, 0 }; data["sv"] = sv; }
+  if (!d || s.set != prev->set) data["set"] = s.set;
+  if (!d || s.ma != prev->ma) data["ma"] = s.ma;
+  if (!d || s.mb != prev->mb) data["mb"] = s.mb;
+  if (!d || s.bo != prev->bo) data["bo"] = s.bo;
+  if (!d || s.ble != prev->ble) data["ble"] = s.ble;
   // rotations
   {
-    JsonArray ra = data["ra"].to<JsonArray>();
-    for (int i=0;i<6;i++) ra.add(S.ra[i]);
-    JsonArray rb = data["rb"].to<JsonArray>();
-    for (int i=0;i<6;i++) rb.add(S.rb[i]);
-    data["rsa"] = (int)S.rsa;
-    data["rsb"] = (int)S.rsb;
+    bool raSame = d, rbSame = d;
+    for (int i=0;i<6 && d;i++) { raSame = raSame && strcmp(s.ra[i], prev->ra[i]) == 0; rbSame = rbSame && strcmp(s.rb[i], prev->rb[i]) == 0; }
+    if (!raSame) { JsonArray ra = data["ra"].to<JsonArray>(); for (int i=0;i<6;i++) ra.add(s.ra[i]); }
+    if (!rbSame) { JsonArray rb = data["rb"].to<JsonArray>(); for (int i=0;i<6;i++) rb.add(s.rb[i]); }
+    if (!d || s.rsa != prev->rsa) data["rsa"] = (int)s.rsa;
+    if (!d || s.rsb != prev->rsb) data["rsb"] = (int)s.rsb;
   }
   // last 4 logs per team
-  {
-    JsonArray la = data["la"].to<JsonArray>();
-    for (int i=0;i<S.laCount; i++) {
-      JsonObject e = la.add<JsonObject>();
-      e["reason"] = S.la[i].reason;
-      e["scorer"] = S.la[i].scorer;
-      e["ts"] = (uint32_t)S.la[i].ts;
-    }
-    JsonArray lb = data["lb"].to<JsonArray>();
-    for (int i=0;i<S.lbCount; i++) {
-      JsonObject e = lb.add<JsonObject>();
-      e["reason"] = S.lb[i].reason;
-      e["scorer"] = S.lb[i].scorer;
-      e["ts"] = (uint32_t)S.lb[i].ts;
-    }
-  }
-  xSemaphoreGive(stateMutex);
+  writeLogs(data, "la", "la+", s.la, s.laCount, d ? prev->la : nullptr, d ? prev->laCount : 0, d);
+  writeLogs(data, "lb", "lb+", s.lb, s.lbCount, d ? prev->lb : nullptr, d ? prev->lbCount : 0, d);
+}
+
+// Full state message for a copy of the state taken at version `seq`. `boot`
+// scopes the version: a client compares the pair, as versions restart at 1.
+void stateDoc(JsonDocument& doc, const ScoreboardState& s, uint32_t seq) {
+  doc["type"] = "state";
+  doc["boot"] = gBootId;
+  doc["seq"] = seq;
+  writeStateFields(doc["data"].to<JsonObject>(), s, nullptr);  // CHANGED: create nested object per v7
+}
+
+// Patch taking a client from version `base` (state `prev`) to `seq` (state `cur`).
+void patchDoc(JsonDocument& doc, const ScoreboardState& prev, uint32_t base, const ScoreboardState& cur, uint32_t seq) {
+  doc["type"] = "patch";
+  doc["boot"] = gBootId;
+  doc["base"] = base;
+  doc["seq"] = seq;
+  writeStateFields(doc["data"].to<JsonObject>(), cur, &prev);
+}
+
+void errorDoc(JsonDocument& doc, const char* code, const String& msg) {
+  doc["type"] = "error";
+  doc["data"]["code"] = code;
+  doc["data"]["msg"] = msg;
+}
+
+// Owner task only, after mutating S.
+void publishState() {
+  static PublishedState next;  // single writer, so one scratch copy
+  gStateVersion++;
+  next.st = S;
+  next.version = gStateVersion;
+  gPublished.store(next);
+}
+
+// Lock-free read of the latest published state; returns its version.
+uint32_t copyState(ScoreboardState& out) {
+  uint32_t v = 0;
+  gPublished.read([&](const PublishedState& p) { memcpy(&out, &p.st, sizeof(out)); v = p.version; });
+  return v;
+}
+
+// Shared, immutable serialization of the current state. BLE, SSE and HTTP all
+// hold a reference to the same String instead of serializing per consumer.
+// Published by loop() (the "http" sink), so readers on the network task only
+// take snapshotMutex for a pointer copy and never wait on the state owner; a reader
+// may see the previous version for one loop pass, with a matching ETag/seq.
+String stateToJson(const ScoreboardState& st, uint32_t v) {
+  JsonDocument doc;
+  stateDoc(doc, st, v);
+  String json;
+  serializeJson(doc, json);
+  return json;
+}
 
-  String out;
-  serializeJson(doc, out);
+// Both encodings are built from one document per version, so a msgpack GET is
+// a pointer copy like a JSON one instead of a parse and re-encode per request.
+void publishSnapshot(const ScoreboardState& st, uint32_t v) {
+  JsonDocument doc;
+  stateDoc(doc, st, v);
+  String json;
+  serializeJson(doc, json);
+  auto snap = std::make_shared<const String>(std::move(json));
+  auto bin = std::make_shared<const std::string>(encodeMessage(doc, Codec::MsgPack));
+  xSemaphoreTake(snapshotMutex, portMAX_DELAY);
+  gSnapshot = snap;
+  gSnapshotMsgpack = bin;
+  gSnapshotVersion = v;
+  xSemaphoreGive(snapshotMutex);
+}
+
+std::shared_ptr<const String> stateSnapshot(uint32_t* versionOut, std::shared_ptr<const std::string>* msgpackOut) {
+  xSemaphoreTake(snapshotMutex, portMAX_DELAY);
+  std::shared_ptr<const String> out = gSnapshot;
+  if (versionOut) *versionOut = gSnapshotVersion;
+  if (msgpackOut) *msgpackOut = gSnapshotMsgpack;
+  xSemaphoreGive(snapshotMutex);
   return out;
 }
 
 bool applyDataObject(JsonObject data, String* err) {
   auto clamp = [](int v, int lo, int hi){ return v < lo ? lo : (v > hi ? hi : v); };
-  // Names
-  if (data["ta"].is<const char*>()) S.ta = String((const char*)data["ta"]).substring(0, 20);   // CHANGED: v7 style
-  if (data["tb"].is<const char*>()) S.tb = String((const char*)data["tb"]).substring(0, 20);   // CHANGED
-  // Colors (basic trust)
-  if (data["ca"].is<const char*>()) S.ca = String((const char*)data["ca"]);                     // CHANGED
-  if (data["cb"].is<const char*>()) S.cb = String((const char*)data["cb"]);                     // CHANGED
-  if (data["abg"].is<const char*>()) S.abg = String((const char*)data["abg"]);
-  if (data["bbg"].is<const char*>()) S.bbg = String((const char*)data["bbg"]);
+  // Names (truncated to ScoreboardState::kNameLen bytes)
+  if (data["ta"].is<const char*>()) setText(S.ta, data["ta"].as<const char*>());                // CHANGED: v7 style
+  if (data["tb"].is<const char*>()) setText(S.tb, data["tb"].as<const char*>());                // CHANGED
+  // Colors: must be #rrggbb; decoded to RGB565 once, here
+  struct { const char* key; ScoreboardState::Color* dst; } colors[] = {
+    { "ca", &S.ca }, { "cb", &S.cb }, { "abg", &S.abg }, { "bbg", &S.bbg } };
+  for (auto& c : colors) {
+    if (data[c.key].is<const char*>() && !setColor(*c.dst, data[c.key].as<const char*>())) {
+      if (err) { *err = c.key; *err += " must be #rrggbb"; }
+      return false;
+    }
+  }
   // Scores
   if (data["a"].is<int>()) S.a = clamp((int)data["a"], 0, 99);                                   // CHANGED
   if (data["b"].is<int>()) S.b = clamp((int)data["b"], 0, 99);                                   // CHANGED
@@ -130,15 +378,13 @@ bool applyDataObject(JsonObject data, String* err) {
   if (data["ra"].is<JsonArray>()) {
     JsonArray ra = data["ra"].as<JsonArray>();
     for (int i=0;i<6;i++) {
-      if (i < (int)ra.size() && ra[i].is<const char*>()) S.ra[i] = String((const char*)ra[i]);
-      else S.ra[i] = String("");
+      setText(S.ra[i], i < (int)ra.size() ? (ra[i] | "") : "");
     }
   }
   if (data["rb"].is<JsonArray>()) {
     JsonArray rb = data["rb"].as<JsonArray>();
     for (int i=0;i<6;i++) {
-      if (i < (int)rb.size() && rb[i].is<const char*>()) S.rb[i] = String((const char*)rb[i]);
-      else S.rb[i] = String("");
+      setText(S.rb[i], i < (int)rb.size() ? (rb[i] | "") : "");
     }
   }
   if (data["rsa"].is<int>()) S.rsa = (uint8_t)clamp((int)data["rsa"], 0, 5);
@@ -151,9 +397,9 @@ bool applyDataObject(JsonObject data, String* err) {
     S.laCount = 0;
     for (int i=start; i<n && S.laCount < 4; i++) {
       JsonObject e = la[i].as<JsonObject>();
-      S.la[S.laCount].reason = String((const char*)(e["reason"] | ""));
-      S.la[S.laCount].scorer = String((const char*)(e["scorer"] | ""));
-      S.la[S.laCount].ts = (uint32_t)(e["ts"] | 0);
+      setText(S.la[S.laCount].reason, e["reason"] | "");
+      setText(S.la[S.laCount].scorer, e["scorer"] | "");
+      S.la[S.laCount].ts = e["ts"].as<uint64_t>();
       S.laCount++;
     }
   }
@@ -164,12 +410,25 @@ bool applyDataObject(JsonObject data, String* err) {
     S.lbCount = 0;
     for (int i=start; i<n && S.lbCount < 4; i++) {
       JsonObject e = lb[i].as<JsonObject>();
-      S.lb[S.lbCount].reason = String((const char*)(e["reason"] | ""));
-      S.lb[S.lbCount].scorer = String((const char*)(e["scorer"] | ""));
-      S.lb[S.lbCount].ts = (uint32_t)(e["ts"] | 0);
+      setText(S.lb[S.lbCount].reason, e["reason"] | "");
+      setText(S.lb[S.lbCount].scorer, e["scorer"] | "");
+      S.lb[S.lbCount].ts = e["ts"].as<uint64_t>();
       S.lbCount++;
     }
   }
+  // Log appends from patches ("la+"/"lb+"): push onto the tail, dropping the oldest
+  auto appendLogs = [](JsonArray src, ScoreboardState::LogEntry* dst, uint8_t& count) {
+    for (JsonVariant v : src) {
+      JsonObject e = v.as<JsonObject>();
+      if (count == 4) { for (int i=1; i<4; i++) dst[i-1] = dst[i]; count = 3; }
+      setText(dst[count].reason, e["reason"] | "");
+      setText(dst[count].scorer, e["scorer"] | "");
+      dst[count].ts = e["ts"].as<uint64_t>();
+      count++;
+    }
+  };
+  if (data["la+"].is<JsonArray>()) appendLogs(data["la+"].as<JsonArray>(), S.la, S.laCount);
+  if (data["lb+"].is<JsonArray>()) appendLogs(data["lb+"].as<JsonArray>(), S.lb, S.lbCount);
   // Set / Match / Best-of
   if (data["set"].is<int>()) S.set = clamp((int)data["set"], 1, 9);                               // CHANGED
   if (data["ma"].is<int>())  S.ma  = clamp((int)data["ma"], 0, 9);                               // CHANGED
@@ -182,27 +441,148 @@ bool applyDataObject(JsonObject data, String* err) {
   return true;
 }
 
-bool updateStateFromJson(const String& jsonStr, String* errorMsg) {
+// Outcome of one incoming message, for the transport to act on.
+struct MessageResult {
+  String err;              // why the message was rejected
+  JsonDocument reply;      // sent back to the sender instead of the default ack/error
+  Codec codec = Codec::Json; // encoding the message arrived in
+  bool hello = false;      // sender introduced itself and asked for `helloCodec`
+  Codec helloCodec = Codec::Json;
+  bool changed = false;    // S was modified
+  bool fullState = false;  // answer with the full state (hello, resync)
+  uint32_t id = 0;         // sender's message id, echoed in the reply (round-trip timing)
+  uint32_t parseUs = 0;    // time spent decoding it
+  trace::Trace trace;      // stage stamps when the message carries a "cid"
+};
+
+void metricsDoc(JsonDocument& doc);
+
+// ---- Journal ----
+static void putScore(journal::Record& r, const ScoreboardState& s) {
+  auto u8 = [](int v){ return (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v)); };
+  r.u8(u8(s.a)).u8(u8(s.b)).u8(u8(s.set)).u8(u8(s.ma)).u8(u8(s.mb)).u8(s.sv).u8(s.rsa).u8(s.rsb);
+}
+
+journal::Record journalSnapshot() {
+  ScoreboardState st;
+  uint32_t v = copyState(st);
+  journal::Record r(journal::Snapshot, v);
+  putScore(r, st);
+  r.str(st.ta).str(st.tb);
+  return r;
+}
+
+// Record what changed between two states (owner task; only stages bytes in
+// RAM). Logs are journaled when they were appended.
+static void journalChange(const ScoreboardState& before, const ScoreboardState& after, uint32_t seq) {
+  if (before.a != after.a || before.b != after.b || before.set != after.set || before.ma != after.ma ||
+      before.mb != after.mb || before.sv != after.sv || before.rsa != after.rsa || before.rsb != after.rsb) {
+    journal::Record r(journal::Score, seq);
+    putScore(r, after);
+    gJournal.append(r);
+  }
+  if (strcmp(before.ta, after.ta) != 0 || strcmp(before.tb, after.tb) != 0) {
+    journal::Record r(journal::Names, seq);
+    r.str(after.ta).str(after.tb);
+    gJournal.append(r);
+  }
+  struct { char team; const ScoreboardState::LogEntry* prev; uint8_t pn; const ScoreboardState::LogEntry* cur; uint8_t cn; } logs[] = {
+    { 'A', before.la, before.laCount, after.la, after.laCount },
+    { 'B', before.lb, before.lbCount, after.lb, after.lbCount } };
+  for (auto& l : logs) {
+    int k = appendedLogs(l.prev, l.pn, l.cur, l.cn);
+    for (int i = l.cn - k; i < l.cn; i++) {
+      journal::Record r(journal::Log, seq);
+      r.u8(l.team).u64(l.cur[i].ts).str(l.cur[i].scorer).str(l.cur[i].reason);
+      gJournal.append(r);
+    }
+  }
+}
+
+// Apply one incoming message (JSON or MessagePack, sniffed from the first byte)
+// to S. Owner task only; the version is bumped by the caller once per batch.
+// `state`, `patch` and `cmd` mutate S; `hello` and `resync` ask for a full state.
+bool updateStateFromJson(const uint8_t* bytes, size_t len, MessageResult& res) {
   JsonDocument doc;                                      // CHANGED: v7 style
-  DeserializationError e = deserializeJson(doc, jsonStr);
+  res.codec = sniffCodec(bytes, len);
+  uint32_t t0 = micros();
+  DeserializationError e = decodeMessage(doc, bytes, len, res.codec);
+  res.parseUs = micros() - t0;
   if (e) {
-    if (e == DeserializationError::IncompleteInput) {
-      if (errorMsg) *errorMsg = "incomplete";
-      return false; // caller can accumulate more data
-    }
-    if (errorMsg) *errorMsg = String("parse error: ") + e.c_str();
+    gMetrics.parseErrors.add();
+    res.err = String("parse error: ") + e.c_str();
     return false;
   }
+  res.id = doc["id"] | 0;
+  setText(res.trace.cid, doc["cid"] | "");
   const char* type = doc["type"] | "state";
-  if (strcmp(type, "state") == 0) {
+  bool isHello = strcmp(type, "hello") == 0;
+  if (isHello || strcmp(type, "resync") == 0) {
+    if (isHello) {
+      // {"type":"hello","codecs":["msgpack","json"]}: take the first one we speak
+      res.hello = true;
+      for (JsonVariant c : doc["codecs"].as<JsonArray>()) {
+        const char* name = c | "";
+        if (strcmp(name, "msgpack") == 0 || strcmp(name, "json") == 0) { res.helloCodec = codecFromName(name); break; }
+      }
+    }
+    res.fullState = true;
+    return true;
+  }
+  if (strcmp(type, "metrics") == 0) {
+    metricsDoc(res.reply);
+    return true;
+  }
+  bool isPatch = strcmp(type, "patch") == 0;
+  if (strcmp(type, "state") == 0 || isPatch) {
     JsonObject data = doc["data"].as<JsonObject>();
     String err;
-    bool ok = false;
-    xSemaphoreTake(stateMutex, portMAX_DELAY);
-    ok = applyDataObject(data, &err);
-    xSemaphoreGive(stateMutex);
+    // A patch based on a version this device never produced (it rebooted
+    // since, or the version is from before the reboot) is refused; the client
+    // answers with a full state.
+    uint32_t base = doc["base"] | 0;
+    uint32_t boot = doc["boot"] | 0u;
+    if (isPatch && (base > gStateVersion || (boot && boot != gBootId))) {
+      res.err = "stale base";
+      errorDoc(res.reply, "stale", res.err);
+      res.reply["data"]["boot"] = gBootId;
+      res.reply["data"]["seq"] = gStateVersion;
+      return false;
+    }
+    ScoreboardState before = S;
+    bool ok = applyDataObject(data, &err);
+    res.changed = true;  // partial applies still count as a change
+    journalChange(before, S, gStateVersion + 1);
     if (!ok) {
-      if (errorMsg) *errorMsg = err;
+      res.err = err;
+      return false;
+    }
+    return true;
+  }
+  if (strcmp(type, "cmd") == 0) {
+    // {"type":"cmd","op":"point","team":"A","ts":<epoch ms>}
+    scoring::Op op = scoring::opFromName(doc["op"] | "");
+    char team = (doc["team"] | " ")[0];
+    uint64_t ts = doc["ts"] | (uint64_t)0;
+    bool ok;
+    ScoreboardState prev = S;
+    if (op == scoring::Op::Undo) ok = gHistory.undo(S);
+    else if (op == scoring::Op::Redo) ok = gHistory.redo(S);
+    else {
+      scoring::Score before = scoring::Score::of(S);
+      ok = scoring::apply(S, op, team, ts);
+      if (ok) gHistory.record(before);
+    }
+    if (ok) {
+      res.changed = true;
+      journal::Record r(journal::Cmd, gStateVersion + 1);
+      r.u8((uint8_t)op).u8(team).u64(ts);
+      gJournal.append(r);
+      journalChange(prev, S, gStateVersion + 1);
+    }
+    if (!ok) {
+      res.err = op == scoring::Op::Undo ? "nothing to undo"
+              : op == scoring::Op::Redo ? "nothing to redo" : "bad command";
       return false;
     }
     return true;
@@ -211,43 +591,241 @@ bool updateStateFromJson(const String& jsonStr, String* errorMsg) {
   return true;
 }
 
+// ---- Update queue ----
+// Transports hand raw messages to the state owner through a lock-free MPSC
+// queue and return at once; the owner parses and applies them in batches.
+struct Update {
+  enum Kind : uint8_t { Message, BleCount } kind = Message;
+  enum From : uint8_t { FromBle, FromHttp, FromWs, FromLocal, FromCount } from = FromLocal;
+  uint8_t bleCount = 0;          // BleCount: centrals now connected
+  uint32_t bleLink = 0;          // FromBle: BleLink::id of the sender
+  AsyncWebServerRequestPtr req;  // FromHttp: answered once applied
+  uint32_t wsClient = 0;         // FromWs: AsyncWebSocketClient::id()
+  uint32_t queuedUs = 0;         // micros() when submitted
+  Codec replyCodec = Codec::Json;
+  void* buf = nullptr;           // owns the bytes; released with free()
+  const uint8_t* data = nullptr;
+  size_t len = 0;
+};
+MpscQueue<Update*, 32> gUpdates;
+TaskHandle_t stateOwnerTask = nullptr;
+struct OwnerStats {
+  uint32_t updates = 0;
+  uint32_t batches = 0;
+  uint32_t versions = 0;
+  uint32_t rejected = 0;   // queue full
+  uint32_t maxBatch = 0;
+  uint32_t lastApplyUs = 0;
+  uint32_t maxApplyUs = 0;
+} gOwner;
+// Device time per message and transport: receiving it (callback/handler),
+// answering it (encode + send), and from queueing to the reply being sent.
+struct TransportStats {
+  uint32_t messages = 0;
+  uint64_t inUs = 0;
+  uint64_t outUs = 0;
+  uint64_t turnUs = 0;
+  uint32_t maxTurnUs = 0;
+} gTransport[Update::FromCount];
+
+// A traced message's reply, parked until the display and network sinks have
+// handled the version it produced (see trace.h).
+struct TracedReply {
+  Update* u = nullptr;
+  MessageResult res;
+  bool ok = false;
+};
+trace::Table<TracedReply, 8> gTraces;
+constexpr uint32_t kTraceTimeoutUs = 1000000;
+
+// Any task. On failure the caller still owns `u`.
+bool submitUpdate(Update* u) {
+  u->queuedUs = micros();
+  if (!gUpdates.push(u)) { gOwner.rejected++; return false; }
+  xTaskNotifyGive(stateOwnerTask);
+  return true;
+}
+
+// Copy `n` bytes into a new queued message; false if the queue is full.
+bool submitMessage(Update::From from, const uint8_t* p, size_t n, uint32_t bleLink = 0) {
+  Update* u = new Update;
+  u->from = from;
+  u->bleLink = bleLink;
+  u->buf = malloc(n);
+  if (!u->buf) { delete u; return false; }
+  memcpy(u->buf, p, n);
+  u->data = (const uint8_t*)u->buf;
+  u->len = n;
+  if (submitUpdate(u)) return true;
+  free(u->buf);
+  delete u;
+  return false;
+}
+
+// ---- BLE links ----
+// Slot of a connection (NimBLE host task, which alone claims and frees slots,
+// so it may look up without the lock).
+BleLink* bleLinkByConn(uint16_t conn) {
+  if (conn == BLE_HS_CONN_HANDLE_NONE) return nullptr;
+  for (auto& l : gBleLinks) if (l.conn == conn) return &l;
+  return nullptr;
+}
+
+// Slot of a connection id; call with bleLinksMutex held. Null once it disconnected.
+BleLink* bleLinkById(uint32_t id) {
+  for (auto& l : gBleLinks) if (id && l.id == id && l.conn != BLE_HS_CONN_HANDLE_NONE) return &l;
+  return nullptr;
+}
+
+uint8_t bleConnectedCount() {
+  uint8_t n = 0;
+  for (auto& l : gBleLinks) if (l.conn != BLE_HS_CONN_HANDLE_NONE) n++;
+  return n;
+}
+
+// Queue a reply for one central (any task); encoded in that central's codec.
+// Dropped if it has disconnected since.
+void bleSend(uint32_t link, const JsonDocument& doc) {
+  xSemaphoreTake(bleLinksMutex, portMAX_DELAY);
+  BleLink* l = bleLinkById(link);
+  Codec codec = l ? l->codec : Codec::Json;
+  xSemaphoreGive(bleLinksMutex);
+  if (!l) return;
+  std::string payload = encodeMessage(doc, codec);
+  xSemaphoreTake(bleLinksMutex, portMAX_DELAY);
+  if ((l = bleLinkById(link))) {
+    if (l->outbox.size() >= kBleOutboxMax) {
+      l->outbox.erase(l->outbox.begin());
+      l->tx.dropped++;
+    }
+    l->outbox.push_back(std::move(payload));
+  }
+  xSemaphoreGive(bleLinksMutex);
+  if (bleSinkTask) xTaskNotifyGive(bleSinkTask);
+}
+
+void bleSetCodec(uint32_t link, Codec codec) {
+  xSemaphoreTake(bleLinksMutex, portMAX_DELAY);
+  if (BleLink* l = bleLinkById(link)) {
+    l->codec = codec;
+    Serial.printf("[BLE] conn %u codec: %s\n", l->conn, codecName(codec));
+  }
+  xSemaphoreGive(bleLinksMutex);
+}
+
 // ---- BLE callbacks ----
+
 class RxCallbacks : public NimBLECharacteristicCallbacks {
   void onWrite(NimBLECharacteristic* c, NimBLEConnInfo& connInfo) override {  // CHANGED: signature uses NimBLEConnInfo in newer NimBLE
-    std::string v = c->getValue();
-    if (v.empty()) return;
-    bleRxBuffer.append(v);
-    String err;
-    if (updateStateFromJson(String(bleRxBuffer.c_str()), &err)) {
-      bleRxBuffer.clear();
-      scheduleBroadcast();
-    } else {
-      if (err != "incomplete") {
-        Serial.printf("[BLE] JSON error: %s\n", err.c_str());
-        bleRxBuffer.clear();
-        // send error
-        JsonDocument ed;                                  // CHANGED: v7 style
-        ed["type"] = "error";
-        ed["data"]["code"] = "parse";
-        ed["data"]["msg"] = err;
-        String out; serializeJson(ed, out);
-        if (pTx) { pTx->setValue(out); pTx->notify(); }
-      }
+    uint32_t t0 = micros();
+    handleWrite(c, connInfo);
+    gTransport[Update::FromBle].inUs += micros() - t0;
+  }
+  static void handleWrite(NimBLECharacteristic* c, NimBLEConnInfo& connInfo) {
+    BleLink* l = bleLinkByConn(connInfo.getConnHandle());
+    if (!l) return;
+    NimBLEAttValue v = c->getValue();
+    if (v.size() == 0) return;
+    MessageResult res;
+    switch (l->rx.feed(v.data(), v.size(), millis())) {
+      case bleframe::Reassembler::Pending:
+        return;
+      case bleframe::Reassembler::Error:
+        Serial.printf("[BLE] conn %u RX frame error: %s (%u timeouts, %u errors)\n", l->conn,
+                      l->rx.error(), (unsigned)l->rx.timeouts, (unsigned)l->rx.errors);
+        errorDoc(res.reply, "frame", l->rx.error());
+        bleSend(l->id, res.reply);
+        return;
+      case bleframe::Reassembler::Complete:
+        break;
+    }
+    if (!submitMessage(Update::FromBle, l->rx.data(), l->rx.size(), l->id)) {
+      errorDoc(res.reply, "busy", "update queue full");
+      bleSend(l->id, res.reply);
     }
   }
 };
 
+class TxCallbacks : public NimBLECharacteristicCallbacks {
+  // A new subscriber gets a full state from the BLE sink task.
+  void onSubscribe(NimBLECharacteristic* c, NimBLEConnInfo& connInfo, uint16_t subValue) override {
+    BleLink* l = bleLinkByConn(connInfo.getConnHandle());
+    if (!l) return;
+    xSemaphoreTake(bleLinksMutex, portMAX_DELAY);
+    l->subscribed = subValue & 1;
+    xSemaphoreGive(bleLinksMutex);
+    Serial.printf("[BLE] conn %u %s\n", l->conn, (subValue & 1) ? "subscribed" : "unsubscribed");
+    if (bleSinkTask) xTaskNotifyGive(bleSinkTask);
+  }
+};
+
 class ServerCallbacks : public NimBLEServerCallbacks {
   void onConnect(NimBLEServer* s, NimBLEConnInfo& connInfo) override {          // CHANGED: signature
-    Serial.println("[BLE] Central connected");
-    withState([](ScoreboardState& st){ st.ble = true; });
-    scheduleBroadcast();
+    uint16_t conn = connInfo.getConnHandle();
+    BleLink* l = nullptr;
+    xSemaphoreTake(bleLinksMutex, portMAX_DELAY);
+    for (auto& slot : gBleLinks) if (slot.conn == BLE_HS_CONN_HANDLE_NONE) { l = &slot; break; }
+    if (l) {
+      l->conn = conn;
+      l->id = ++gBleLinkIds;
+      l->mtu = connInfo.getMTU();
+      l->subscribed = false;
+      l->codec = Codec::Json;
+      l->outbox.clear();
+    }
+    uint8_t count = bleConnectedCount();
+    xSemaphoreGive(bleLinksMutex);
+    if (!l) {
+      Serial.printf("[BLE] conn %u refused: %u centrals connected\n", conn, count);
+      s->disconnect(conn);
+      return;
+    }
+    l->rx.reset();
+    setLinkInterval(*l, connInfo);
+    Serial.printf("[BLE] Central %u connected (mtu %u, interval %u ms, %u/%u)\n",
+                  conn, l->mtu, (unsigned)l->gate.intervalMs(), count, (unsigned)kMaxBleLinks);
+    submitBleCount(count);
+    if (count < kMaxBleLinks) NimBLEDevice::startAdvertising();  // stay discoverable for the next central
   }
   void onDisconnect(NimBLEServer* s, NimBLEConnInfo& connInfo, int reason) override { // CHANGED: signature
-    Serial.printf("[BLE] Central disconnected (%d)\n", reason);
-    withState([](ScoreboardState& st){ st.ble = false; });
+    BleLink* l = bleLinkByConn(connInfo.getConnHandle());
+    xSemaphoreTake(bleLinksMutex, portMAX_DELAY);
+    if (l) {
+      l->conn = BLE_HS_CONN_HANDLE_NONE;
+      l->subscribed = false;
+      l->outbox.clear();
+    }
+    uint8_t count = bleConnectedCount();
+    xSemaphoreGive(bleLinksMutex);
+    if (l) l->rx.reset();
+    Serial.printf("[BLE] Central %u disconnected (%d), %u left\n", connInfo.getConnHandle(), reason, count);
+    submitBleCount(count);
     NimBLEDevice::startAdvertising();
-    scheduleBroadcast();
+  }
+  void onMTUChange(uint16_t mtu, NimBLEConnInfo& connInfo) override {
+    BleLink* l = bleLinkByConn(connInfo.getConnHandle());
+    if (!l) return;
+    xSemaphoreTake(bleLinksMutex, portMAX_DELAY);
+    l->mtu = mtu;
+    xSemaphoreGive(bleLinksMutex);
+    Serial.printf("[BLE] conn %u MTU %u\n", l->conn, mtu);
+  }
+  void onConnParamsUpdate(NimBLEConnInfo& connInfo) override {
+    BleLink* l = bleLinkByConn(connInfo.getConnHandle());
+    if (!l) return;
+    setLinkInterval(*l, connInfo);
+    Serial.printf("[BLE] conn %u interval %u ms\n", l->conn, (unsigned)l->gate.intervalMs());
+  }
+  static void submitBleCount(uint8_t count) {
+    Update* u = new Update;
+    u->kind = Update::BleCount;
+    u->bleCount = count;
+    if (!submitUpdate(u)) delete u;
+  }
+  // One state update per connection event at most; the interval is in 1.25 ms units.
+  static void setLinkInterval(BleLink& l, NimBLEConnInfo& connInfo) {
+    uint32_t ms = connInfo.getConnInterval() * 5 / 4;
+    l.gate.setInterval(ms < 15 ? 15 : ms);
   }
 };
 
@@ -261,6 +839,7 @@ void setupBLE() {
 
   NimBLEService* svc = pServer->createService(SERVICE_UUID);
   pTx = svc->createCharacteristic(TX_CHAR_UUID, NIMBLE_PROPERTY::NOTIFY);
+  pTx->setCallbacks(new TxCallbacks());
   pRx = svc->createCharacteristic(RX_CHAR_UUID,
     NIMBLE_PROPERTY::WRITE | NIMBLE_PROPERTY::WRITE_NR);
   pRx->setCallbacks(new RxCallbacks());
@@ -274,7 +853,7 @@ void setupBLE() {
   scanData.setName("VSDisplay");
   adv->setScanResponseData(scanData);
   adv->start();
-  Serial.println("[BLE] Advertising");
+  Serial.printf("[BLE] Advertising (up to %u centrals)\n", (unsigned)kMaxBleLinks);
 }
 
 // ---- HTTP ----
@@ -282,6 +861,334 @@ void addCorsHeaders(AsyncWebServerResponse* r) {
   r->addHeader("Access-Control-Allow-Origin", GH_PAGES_ORIGIN);
   r->addHeader("Access-Control-Allow-Methods", "GET, POST, OPTIONS");
   r->addHeader("Access-Control-Allow-Headers", "Content-Type, Authorization");
+  r->addHeader("Access-Control-Expose-Headers", "ETag");
+}
+
+// MessagePack for clients that ask for it (Accept or, for POST replies, the
+// request's own Content-Type); JSON otherwise.
+Codec httpCodec(AsyncWebServerRequest* req) {
+  const AsyncWebHeader* h = req->getHeader("Accept");
+  if (h && h->value().indexOf("application/msgpack") >= 0) return Codec::MsgPack;
+  return req->contentType().indexOf("application/msgpack") >= 0 ? Codec::MsgPack : Codec::Json;
+}
+
+void sendDoc(AsyncWebServerRequest* req, int code, const JsonDocument& doc, Codec codec) {
+  std::string out = encodeMessage(doc, codec);
+  auto* r = req->beginResponse(code, codec == Codec::MsgPack ? "application/msgpack" : "application/json",
+                               (const uint8_t*)out.data(), out.size());
+  addCorsHeaders(r);
+  req->send(r);
+}
+
+// ---- HTTP bodies ----
+// POST bodies live in a per-request buffer (AsyncWebServerRequest::_tempObject,
+// released with free() by the server), so concurrent controllers cannot mix
+// payloads. A complete body is handed to the state owner, which answers the
+// paused request through a weak pointer, so a client that hung up in the
+// meantime is simply skipped.
+constexpr size_t kMaxHttpBody = bleframe::Reassembler::kMaxMessage;
+struct HttpBody {
+  size_t cap;
+  size_t len;
+  bool tooLarge;
+  bool noMemory;  // the full buffer could not be allocated; only this header was
+  uint8_t data[];
+};
+
+// ---- WebSocket ----
+// Reply to one client in the encoding its message used: JSON as a text frame,
+// MessagePack as a binary frame. A client that has left is skipped.
+void wsSend(uint32_t client, const JsonDocument& doc, Codec codec) {
+  std::string out = encodeMessage(doc, codec);
+  if (codec == Codec::MsgPack) ws.binary(client, (const uint8_t*)out.data(), out.size());
+  else ws.text(client, out.data(), out.size());
+}
+
+static void wsSubmit(AsyncWebSocketClient* client, HttpBody* body, Codec codec) {
+  Update* u = new Update;
+  u->from = Update::FromWs;
+  u->wsClient = client->id();
+  u->replyCodec = codec;
+  u->buf = body;
+  u->data = body->data;
+  u->len = body->len;
+  if (submitUpdate(u)) return;
+  free(body);
+  delete u;
+  JsonDocument err;
+  errorDoc(err, "busy", "try again");
+  wsSend(client->id(), err, codec);
+}
+
+// One message per frame; a frame may arrive in several pieces and is
+// collected per client. Fragmented (multi-frame) messages are refused.
+static void onWsData(AsyncWebSocketClient* client, AwsFrameInfo* info, uint8_t* data, size_t len) {
+  Codec codec = info->opcode == WS_BINARY ? Codec::MsgPack : Codec::Json;
+  if (info->num > 0 || !info->final || info->len > kMaxHttpBody) {
+    if (info->index == 0 && info->num == 0) {
+      JsonDocument err;
+      if (info->len > kMaxHttpBody) errorDoc(err, "too_large", String("message exceeds ") + kMaxHttpBody + " bytes");
+      else errorDoc(err, "frame", "fragmented messages are not supported");
+      wsSend(client->id(), err, codec);
+    }
+    return;
+  }
+  xSemaphoreTake(wsMutex, portMAX_DELAY);
+  WsClient* c = nullptr;
+  for (auto& wc : gWsClients) if (wc.id == client->id()) { c = &wc; break; }
+  HttpBody* body = nullptr;
+  if (c) {
+    if (info->index == 0) {
+      free(c->partial);
+      c->partial = (HttpBody*)malloc(sizeof(HttpBody) + info->len);
+      if (c->partial) { c->partial->cap = info->len; c->partial->len = 0; c->partial->tooLarge = false; c->partial->noMemory = false; }
+    }
+    HttpBody* b = c->partial;
+    if (b && info->index == b->len && b->len + len <= b->cap) {
+      memcpy(b->data + b->len, data, len);
+      b->len += len;
+      if (b->len == b->cap) { body = b; c->partial = nullptr; }
+    }
+  }
+  xSemaphoreGive(wsMutex);
+  if (body) wsSubmit(client, body, codec);
+}
+
+// ---- State owner ----
+// The only task that writes S. Drains the queue in batches, applies every
+// pending update, publishes one new version for the whole batch, then replies.
+constexpr size_t kMaxBatch = 16;
+
+static void ackDoc(JsonDocument& doc) {
+  doc["type"]="ack"; doc["data"]["ok"]=true; doc["data"]["seq"]=gStateVersion;  // CHANGED: v7 style
+}
+
+// HTTP and WebSocket always answer: an ack, the message's own reply, or an
+// error. Returns the HTTP status.
+static int ackOrError(bool ok, MessageResult& res) {
+  if (ok) {
+    if (res.reply.isNull()) ackDoc(res.reply);
+    return 200;
+  }
+  bool stale = !res.reply.isNull();
+  if (!stale) errorDoc(res.reply, "parse", res.err);
+  return stale ? 409 : 400;
+}
+
+// Echoes the cid and adds the stage durations in microseconds: "queueUs"
+// (transport to state owner), "parseUs", "applyUs", "renderWaitUs" (applied to
+// display start), "renderUs", "bleUs"/"sseUs"/"wsUs" (applied to handed to the
+// transport) and "totalUs" (receipt to the last stage seen). Stages that did
+// not happen (no change, no client on that transport) are left out.
+static void addTrace(JsonDocument& doc, const trace::Trace& t) {
+  using trace::Stage;
+  doc["cid"] = t.cid;
+  JsonObject o = doc["data"]["trace"].to<JsonObject>();
+  auto span = [&](const char* key, Stage from, Stage to) {
+    if (t.has(from) && t.has(to)) o[key] = t.at[to] - t.at[from];
+  };
+  if (t.has(trace::Start)) o["queueUs"] = t.at[trace::Start] - t.rxUs;
+  span("parseUs", trace::Start, trace::Parsed);
+  span("applyUs", trace::Parsed, trace::Applied);
+  span("renderWaitUs", trace::Applied, trace::RenderStart);
+  span("renderUs", trace::RenderStart, trace::RenderEnd);
+  span("bleUs", trace::Applied, trace::Ble);
+  span("sseUs", trace::Applied, trace::Sse);
+  span("wsUs", trace::Applied, trace::Ws);
+  uint32_t total = 0;
+  for (int s = 0; s < trace::kStages; s++) {
+    if (t.has((Stage)s) && t.at[s] - t.rxUs > total) total = t.at[s] - t.rxUs;
+  }
+  o["totalUs"] = total;
+  if (t.timedOut) o["timedOut"] = true;
+}
+
+static void replyToUpdate(Update& u, bool ok, MessageResult& res) {
+  if (res.fullState) {
+    stateDoc(res.reply, S, gStateVersion);
+    if (res.hello) res.reply["codec"] = codecName(res.helloCodec);
+  }
+  int code = 0;
+  if (u.from == Update::FromBle) {
+    if (res.hello) bleSetCodec(u.bleLink, res.helloCodec);
+    if (!ok) {
+      Serial.printf("[BLE] %s error: %s\n", codecName(res.codec), res.err.c_str());
+      if (res.reply.isNull()) errorDoc(res.reply, "parse", res.err);
+    }
+  } else if (u.from == Update::FromHttp || u.from == Update::FromWs) {
+    code = ackOrError(ok, res);
+  }
+  if (res.trace.active()) {
+    if (res.reply.isNull()) ackDoc(res.reply);  // traced BLE writes are acked too
+    addTrace(res.reply, res.trace);
+  }
+  if (res.reply.isNull()) return;
+  if (res.id) res.reply["id"] = res.id;
+  if (u.from == Update::FromBle) {
+    bleSend(u.bleLink, res.reply);
+  } else if (u.from == Update::FromHttp) {
+    if (auto req = u.req.lock()) sendDoc(req.get(), code, res.reply, u.replyCodec);
+  } else if (u.from == Update::FromWs) {
+    wsSend(u.wsClient, res.reply, u.replyCodec);
+  }
+}
+
+// Stages a traced change waits for: the display always, and each transport
+// that has someone to send to right now.
+static uint16_t traceWaitMask() {
+  uint16_t m = 1u << trace::RenderStart | 1u << trace::RenderEnd;
+  xSemaphoreTake(bleLinksMutex, portMAX_DELAY);
+  for (const BleLink& l : gBleLinks) {
+    if (l.conn != BLE_HS_CONN_HANDLE_NONE && l.subscribed) m |= 1u << trace::Ble;
+  }
+  xSemaphoreGive(bleLinksMutex);
+  if (events.count()) m |= 1u << trace::Sse;
+  if (ws.count()) m |= 1u << trace::Ws;
+  return m;
+}
+
+// loop(): send the parked replies whose traces completed or timed out.
+static void finishTraces() {
+  gTraces.take(micros(), kTraceTimeoutUs, [](trace::Trace& t, TracedReply& r) {
+    Serial.printf("[TRACE] %s v%u: %lu us%s\n", t.cid, (unsigned)t.version,
+      (unsigned long)(micros() - t.rxUs), t.timedOut ? " (timed out)" : "");
+    r.res.trace = t;
+    replyToUpdate(*r.u, r.ok, r.res);
+    delete r.u;
+  });
+}
+
+void stateOwnerLoop(void*) {
+  Update* batch[kMaxBatch];
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    for (;;) {
+      size_t n = 0;
+      while (n < kMaxBatch && gUpdates.pop(batch[n])) n++;
+      if (!n) break;
+      uint32_t t0 = micros();
+      MessageResult res[kMaxBatch];
+      bool ok[kMaxBatch];
+      bool changed = false;
+      for (size_t i = 0; i < n; i++) {
+        Update& u = *batch[i];
+        if (u.kind == Update::BleCount) {
+          S.ble = u.bleCount;
+          ok[i] = res[i].changed = true;
+        } else {
+          uint32_t m0 = micros();
+          ok[i] = updateStateFromJson(u.data, u.len, res[i]);
+          uint32_t m1 = micros();
+          gMetrics.messages.add();
+          gMetrics.parse.record(res[i].parseUs);
+          gMetrics.apply.record(m1 - m0 - res[i].parseUs);
+          trace::Trace& tr = res[i].trace;
+          if (tr.active()) {
+            tr.rxUs = u.queuedUs;
+            tr.mark(trace::Start, m0);
+            tr.mark(trace::Parsed, m0 + res[i].parseUs);
+            tr.mark(trace::Applied, m1);
+          }
+          free(u.buf);
+          u.buf = nullptr;
+        }
+        changed |= res[i].changed;
+      }
+      // Traced changes park their reply before the version is published, so
+      // no sink can handle it unstamped.
+      bool parked[kMaxBatch] = {};
+      if (changed) {
+        uint16_t wait = traceWaitMask();
+        for (size_t i = 0; i < n; i++) {
+          if (!res[i].trace.active() || !ok[i] || !res[i].changed || res[i].fullState) continue;
+          TracedReply r;
+          r.u = batch[i];
+          r.ok = ok[i];
+          r.res = std::move(res[i]);
+          r.res.trace.version = gStateVersion + 1;
+          r.res.trace.wait = wait;
+          parked[i] = gTraces.open(r.res.trace, r);
+          if (!parked[i]) res[i] = std::move(r.res);
+        }
+        publishState();
+        gOwner.versions++;
+      }
+      uint32_t dt = micros() - t0;
+      gOwner.updates += n;
+      gOwner.batches++;
+      if (n > gOwner.maxBatch) gOwner.maxBatch = n;
+      gOwner.lastApplyUs = dt;
+      if (dt > gOwner.maxApplyUs) gOwner.maxApplyUs = dt;
+      if (changed) scheduleBroadcast();
+      for (size_t i = 0; i < n; i++) {
+        if (parked[i]) continue;  // answered by finishTraces(), unmetered
+        Update& u = *batch[i];
+        uint32_t r0 = micros();
+        replyToUpdate(u, ok[i], res[i]);
+        uint32_t r1 = micros();
+        TransportStats& ts = gTransport[u.from];
+        ts.outUs += r1 - r0;
+        ts.turnUs += r1 - u.queuedUs;
+        if (r1 - u.queuedUs > ts.maxTurnUs) ts.maxTurnUs = r1 - u.queuedUs;
+        if (u.kind == Update::Message) ts.messages++;
+        delete batch[i];
+      }
+    }
+  }
+}
+
+// Runtime health for GET /api/v1/metrics and {"type":"metrics"} on any
+// transport. Histograms list bucket counts against the shared upper bounds in
+// "bucketsUs" (the last bucket is open-ended) plus p50/p90/p99 estimates.
+static void addHistogram(JsonObject o, const metrics::Histogram& h) {
+  o["count"] = h.count();
+  o["p50Us"] = h.percentileUs(50);
+  o["p90Us"] = h.percentileUs(90);
+  o["p99Us"] = h.percentileUs(99);
+  o["maxUs"] = h.maxUs();
+  JsonArray b = o["buckets"].to<JsonArray>();
+  for (int i = 0; i < metrics::Histogram::kBuckets; i++) b.add(h.bucket(i));
+}
+
+void metricsDoc(JsonDocument& doc) {
+  doc["type"] = "metrics";
+  JsonObject data = doc["data"].to<JsonObject>();
+  data["seq"] = (uint32_t)gStateVersion;
+  data["uptimeMs"] = millis();
+  JsonObject hist = data["hist"].to<JsonObject>();
+  JsonArray bounds = hist["bucketsUs"].to<JsonArray>();
+  for (int i = 0; i < metrics::Histogram::kBuckets - 1; i++) bounds.add(metrics::Histogram::upperUs(i));
+  addHistogram(hist["parse"].to<JsonObject>(), gMetrics.parse);
+  addHistogram(hist["apply"].to<JsonObject>(), gMetrics.apply);
+  addHistogram(hist["render"].to<JsonObject>(), gMetrics.render);
+  addHistogram(hist["broadcast"].to<JsonObject>(), gMetrics.broadcast);
+  JsonObject counters = data["counters"].to<JsonObject>();
+  counters["messages"] = gMetrics.messages.get();
+  counters["parseErrors"] = gMetrics.parseErrors.get();
+  counters["rejected"] = gOwner.rejected;
+  counters["coalesced"] = gMetrics.coalesced.get();
+  counters["bleNotifyFailed"] = gMetrics.bleNotifyFailed.get();
+  counters["bleStalled"] = gMetrics.bleStalled.get();
+  counters["httpNoMemory"] = gMetrics.httpNoMemory.get();
+  JsonObject heap = data["heap"].to<JsonObject>();
+  heap["free"] = ESP.getFreeHeap();
+  heap["minFree"] = ESP.getMinFreeHeap();
+  heap["largestBlock"] = ESP.getMaxAllocHeap();
+  // Unused stack of each task (bytes on the ESP32), lowest since boot.
+  JsonObject stacks = data["stackFree"].to<JsonObject>();
+  struct { const char* name; TaskHandle_t task; } tasks[] = {
+    { "loop", xTaskGetHandle("loopTask") },
+    { "state_owner", stateOwnerTask },
+    { "sink_ble", bleSinkTask },
+    { "sink_sse", sseSinkTask },
+    { "sink_ws", wsSinkTask },
+    { "journal", gJournal.task() },
+    { "async_tcp", xTaskGetHandle("async_tcp") },
+    { "nimble_host", xTaskGetHandle("nimble_host") },
+  };
+  for (auto& t : tasks) {
+    if (t.task) stacks[t.name] = (uint32_t)uxTaskGetStackHighWaterMark(t.task);
+  }
 }
 
 void setupHTTP() {
@@ -294,9 +1201,148 @@ void setupHTTP() {
     req->send(r);
   });
 
+  // Journal writer counters and the retained segment range. Registered before
+  // /api/v1/journal, which would otherwise also match this path.
+  server.on("/api/v1/journal/stats", HTTP_GET, [](AsyncWebServerRequest* req){
+    journal::Stats st = gJournal.stats();
+    JsonDocument doc;
+    doc["oldest"] = gJournal.oldest();
+    doc["newest"] = gJournal.newest();
+    doc["maxSegments"] = journal::kMaxSegments;
+    doc["retired"] = st.retired;
+    doc["records"] = st.records;
+    doc["dropped"] = st.dropped;
+    doc["flushes"] = st.flushes;
+    doc["writeErrors"] = st.writeErrors;
+    doc["bytesWritten"] = st.bytesWritten;
+    doc["lastFlushUs"] = st.lastFlushUs;
+    doc["maxFlushUs"] = st.maxFlushUs;
+    sendDoc(req, 200, doc, Codec::Json);
+  });
+
+  // Raw journal segments, oldest first, streamed a chunk at a time from flash.
+  server.on("/api/v1/journal", HTTP_GET, [](AsyncWebServerRequest* req){
+    gJournal.flushSoon();
+    auto reader = std::make_shared<journal::Journal::Reader>(gJournal);
+    auto* r = req->beginChunkedResponse("application/octet-stream",
+      [reader](uint8_t* buf, size_t maxLen, size_t index) -> size_t { return reader->read(buf, maxLen); });
+    r->addHeader("Content-Disposition", "attachment; filename=\"journal.bin\"");
+    addCorsHeaders(r);
+    req->send(r);
+  });
+
+  // Per-sink scheduler counters: how far behind each sink is and how many
+  // versions it folded into a later one. One "ble" entry per connected central.
+  server.on("/api/v1/sinks", HTTP_GET, [](AsyncWebServerRequest* req){
+    JsonDocument doc;
+    uint32_t v = gStateVersion;
+    doc["seq"] = v;
+    JsonArray arr = doc["sinks"].to<JsonArray>();
+    auto addGate = [&](const SinkGate* g) {
+      JsonObject o = arr.add<JsonObject>();
+      o["name"] = g->name();
+      o["intervalMs"] = g->intervalMs();
+      o["behind"] = v - g->version();
+      o["runs"] = g->runs();
+      o["coalesced"] = g->coalesced();
+      o["lastRunUs"] = g->lastRunUs();
+      o["maxRunUs"] = g->maxRunUs();
+      o["maxLatencyMs"] = g->maxLatencyMs();
+      return o;
+    };
+    for (const SinkGate* g : { &gDisplaySink, &gSnapshotSink, &gSseSink, &gWsSink }) addGate(g);
+    xSemaphoreTake(bleLinksMutex, portMAX_DELAY);
+    for (const BleLink& l : gBleLinks) {
+      if (l.conn == BLE_HS_CONN_HANDLE_NONE) continue;
+      JsonObject o = addGate(&l.gate);
+      o["conn"] = l.conn;
+      o["mtu"] = l.mtu;
+      o["codec"] = codecName(l.codec);
+      o["subscribed"] = l.subscribed;
+      o["outbox"] = l.outbox.size();
+      o["backlog"] = (uint32_t)l.backlog;
+      o["messages"] = l.tx.messages;
+      o["fragments"] = l.tx.fragments;
+      o["bytesPerSec"] = l.tx.bytesPerSec;
+      o["retries"] = l.tx.retries;
+      o["failures"] = l.tx.failures;
+      o["dropped"] = l.tx.dropped;
+    }
+    xSemaphoreGive(bleLinksMutex);
+    JsonObject sse = doc["sse"].to<JsonObject>();
+    xSemaphoreTake(sseMutex, portMAX_DELAY);
+    sse["replays"] = gSseStats.replays;
+    sse["replayMisses"] = gSseStats.replayMisses;
+    sse["refused"] = gSseStats.refused;
+    sse["ringEvents"] = gSseReplay.size();
+    sse["ringBytes"] = gSseReplay.bytes();
+    JsonArray clients = sse["clients"].to<JsonArray>();
+    for (const SseClient& c : gSseClients) {
+      JsonObject o = clients.add<JsonObject>();
+      o["id"] = c.id;
+      o["version"] = c.version;
+      o["queued"] = c.client->packetsWaiting();
+      o["skipped"] = c.skipped;
+      o["replayed"] = c.replayed;
+    }
+    xSemaphoreGive(sseMutex);
+    JsonObject heap = doc["heap"].to<JsonObject>();
+    heap["free"] = ESP.getFreeHeap();
+    heap["minFree"] = ESP.getMinFreeHeap();
+    heap["maxAlloc"] = ESP.getMaxAllocHeap();
+    JsonArray wsClients = doc["ws"].to<JsonArray>();
+    xSemaphoreTake(wsMutex, portMAX_DELAY);
+    for (const WsClient& c : gWsClients) {
+      JsonObject o = wsClients.add<JsonObject>();
+      o["id"] = c.id;
+      o["version"] = c.version;
+      o["skipped"] = c.skipped;
+    }
+    xSemaphoreGive(wsMutex);
+    // Average device time per message on each transport, to compare them.
+    JsonObject transports = doc["transports"].to<JsonObject>();
+    const char* names[Update::FromCount] = { "ble", "http", "ws", "local" };
+    for (int i = 0; i < Update::FromCount; i++) {
+      const TransportStats& t = gTransport[i];
+      if (!t.messages) continue;
+      JsonObject o = transports[names[i]].to<JsonObject>();
+      o["messages"] = t.messages;
+      o["inUs"] = (uint32_t)(t.inUs / t.messages);
+      o["outUs"] = (uint32_t)(t.outUs / t.messages);
+      o["turnUs"] = (uint32_t)(t.turnUs / t.messages);
+      o["maxTurnUs"] = t.maxTurnUs;
+    }
+    JsonObject owner = doc["owner"].to<JsonObject>();
+    owner["queued"] = gUpdates.size();
+    owner["updates"] = gOwner.updates;
+    owner["batches"] = gOwner.batches;
+    owner["versions"] = gOwner.versions;
+    owner["rejected"] = gOwner.rejected;
+    owner["maxBatch"] = gOwner.maxBatch;
+    owner["lastApplyUs"] = gOwner.lastApplyUs;
+    owner["maxApplyUs"] = gOwner.maxApplyUs;
+    sendDoc(req, 200, doc, Codec::Json);
+  });
+
+  server.on("/api/v1/metrics", HTTP_GET, [](AsyncWebServerRequest* req){
+    JsonDocument doc;
+    metricsDoc(doc);
+    sendDoc(req, 200, doc, Codec::Json);
+  });
+
   server.on("/api/v1/state", HTTP_GET, [](AsyncWebServerRequest* req){
-    String json = stateToJson();
-    auto* r = req->beginResponse(200, "application/json", json);
+    uint32_t version = 0;
+    std::shared_ptr<const std::string> bin;
+    auto snap = stateSnapshot(&version, &bin);
+    String etag = String("\"") + String(gBootId) + "." + String(version) + String("\"");
+    const AsyncWebHeader* inm = req->getHeader("If-None-Match");
+    AsyncWebServerResponse* r;
+    if (inm && inm->value() == etag) r = req->beginResponse(304);
+    else if (httpCodec(req) == Codec::MsgPack)
+      r = req->beginResponse(200, "application/msgpack", (const uint8_t*)bin->data(), bin->size());
+    else r = req->beginResponse(200, "application/json", *snap);
+    r->addHeader("ETag", etag);
+    r->addHeader("Cache-Control", "no-cache");
     addCorsHeaders(r);
     req->send(r);
   });
@@ -307,81 +1353,767 @@ void setupHTTP() {
     req->send(r);
   });
 
-  server.on("/api/v1/scoreboard", HTTP_POST, [](AsyncWebServerRequest* req){}, NULL,
+  // The body is collected into the request's own buffer; once complete the
+  // request is paused and queued for the state owner, which answers it.
+  server.on("/api/v1/scoreboard", HTTP_POST,
+    [](AsyncWebServerRequest* req){
+      uint32_t t0 = micros();
+      auto* body = (HttpBody*)req->_tempObject;
+      Codec codec = httpCodec(req);
+      JsonDocument err;
+      if (body && body->noMemory) {
+        errorDoc(err, "busy", "out of memory, try again");
+        sendDoc(req, 503, err, codec);
+        return;
+      }
+      if (!body || body->tooLarge) {
+        if (body) errorDoc(err, "too_large", String("body exceeds ") + kMaxHttpBody + " bytes");
+        else errorDoc(err, "parse", "empty body");
+        sendDoc(req, body ? 413 : 400, err, codec);
+        return;
+      }
+      if (body->len < body->cap) {  // the client stopped short of its Content-Length
+        errorDoc(err, "parse", String("short body: ") + body->len + " of " + body->cap + " bytes");
+        sendDoc(req, 400, err, codec);
+        return;
+      }
+      Update* u = new Update;
+      u->from = Update::FromHttp;
+      u->req = req->getThis();
+      u->replyCodec = codec;
+      u->buf = body;
+      u->data = body->data;
+      u->len = body->len;
+      req->_tempObject = nullptr;  // the update owns the body now
+      req->pause();
+      if (!submitUpdate(u)) {
+        req->_tempObject = body;  // back to the request, freed with it
+        delete u;
+        errorDoc(err, "busy", "try again");
+        sendDoc(req, 503, err, codec);
+      }
+      gTransport[Update::FromHttp].inUs += micros() - t0;
+    }, NULL,
     [](AsyncWebServerRequest* req, uint8_t* data, size_t len, size_t index, size_t total) {
-      static String body;
-      if (index == 0) body = "";
-      body.concat((const char*)data, len);
-      if (index + len == total) {
-        String err;
-        bool ok = updateStateFromJson(body, &err);
-        if (ok) {
-          scheduleBroadcast();
-          JsonDocument ack;                       // CHANGED: v7 style
-          ack["type"]="ack"; ack["data"]["ok"]=true;
-          String out; serializeJson(ack, out);
-          auto* r = req->beginResponse(200, "application/json", out);
-          addCorsHeaders(r);
-          req->send(r);
-        } else {
-          JsonDocument ed;                        // CHANGED: v7 style
-          ed["type"]="error"; ed["data"]["code"]="parse"; ed["data"]["msg"]=err;
-          String out; serializeJson(ed, out);
-          auto* r = req->beginResponse(400, "application/json", out);
-          addCorsHeaders(r);
-          req->send(r);
+      if (index == 0) {
+        bool tooLarge = total > kMaxHttpBody;
+        size_t cap = tooLarge ? 0 : total;
+        auto* b = (HttpBody*)malloc(sizeof(HttpBody) + cap);
+        bool noMemory = !b;
+        // Keep a bare header so the request handler answers 503, not "empty body"
+        if (noMemory) {
+          gMetrics.httpNoMemory.add();
+          b = (HttpBody*)malloc(sizeof(HttpBody));
+          if (!b) return;
+          cap = 0;
         }
+        b->cap = cap;
+        b->len = 0;
+        b->tooLarge = tooLarge;
+        b->noMemory = noMemory;
+        req->_tempObject = b;  // freed with the request
       }
+      auto* b = (HttpBody*)req->_tempObject;
+      if (!b || b->len + len > b->cap) return;
+      memcpy(b->data + b->len, data, len);
+      b->len += len;
     }
   );
 
+  // Only as many SSE clients as the heap can carry; a refused EventSource gets
+  // a 404 and the PWA falls back to polling. The filter sees every request.
+  events.setFilter([](AsyncWebServerRequest* req) {
+    if (req->url() != "/api/v1/events") return true;
+    xSemaphoreTake(sseMutex, portMAX_DELAY);
+    bool ok = gSseClients.size() < kSseMaxClients && ESP.getFreeHeap() > kSseMinFreeHeap;
+    if (!ok) gSseStats.refused++;
+    xSemaphoreGive(sseMutex);
+    return ok;
+  });
+  // A reconnecting client sends the last event id it saw: replay what it
+  // missed from the ring, or start it over with the current state.
   events.onConnect([](AsyncEventSourceClient *client){
-    Serial.printf("[HTTP] SSE client connected id:%u\n", client->lastId());
-    // Send current state immediately
-    String json = stateToJson();
-    client->send(json.c_str(), "state");
+    uint32_t lastId = client->lastId();
+    xSemaphoreTake(sseMutex, portMAX_DELAY);
+    uint32_t last = sseVersionOf(lastId, gSseReplay.newest());
+    SseClient c{ client, ++gSseClientIds, last };
+    bool replayed = gSseReplay.replay(last, [&](uint32_t v, const std::string& p) {
+      client->send(p.c_str(), "patch", sseEventId(v));
+      c.version = v;
+      c.replayed++;
+    });
+    if (replayed) {
+      gSseStats.replays++;
+    } else {
+      if (lastId) gSseStats.replayMisses++;
+      uint32_t v = 0;
+      auto snap = stateSnapshot(&v);
+      client->send(snap->c_str(), "state", sseEventId(v));
+      c.version = v;
+    }
+    gSseClients.push_back(c);
+    xSemaphoreGive(sseMutex);
+    Serial.printf("[HTTP] SSE client %u connected (last id %08x, %s %u), %u clients, heap %u\n",
+                  (unsigned)c.id, (unsigned)lastId, replayed ? "replayed" : "full state at",
+                  (unsigned)(replayed ? c.replayed : c.version), (unsigned)gSseClients.size(), ESP.getFreeHeap());
+  });
+  events.onDisconnect([](AsyncEventSourceClient *client){
+    xSemaphoreTake(sseMutex, portMAX_DELAY);
+    for (auto it = gSseClients.begin(); it != gSseClients.end(); ++it) {
+      if (it->client == client) { gSseClients.erase(it); break; }
+    }
+    xSemaphoreGive(sseMutex);
   });
   server.addHandler(&events);
 
+  // WebSocket: the same envelope as BLE and HTTP in both directions, on one
+  // connection. A new client starts with the full state, then gets patches
+  // from the ws sink; every request is answered (ack/error, "id" echoed).
+  ws.onEvent([](AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type,
+                void* arg, uint8_t* data, size_t len) {
+    switch (type) {
+      case WS_EVT_CONNECT: {
+        uint32_t v = 0;
+        auto snap = stateSnapshot(&v);
+        client->text(snap->c_str(), snap->length());
+        xSemaphoreTake(wsMutex, portMAX_DELAY);
+        gWsClients.push_back({ client->id(), v });
+        xSemaphoreGive(wsMutex);
+        Serial.printf("[WS] client %u connected, %u clients\n", (unsigned)client->id(), (unsigned)server->count());
+        break;
+      }
+      case WS_EVT_DISCONNECT:
+        xSemaphoreTake(wsMutex, portMAX_DELAY);
+        for (auto it = gWsClients.begin(); it != gWsClients.end(); ++it) {
+          if (it->id == client->id()) { free(it->partial); gWsClients.erase(it); break; }
+        }
+        xSemaphoreGive(wsMutex);
+        break;
+      case WS_EVT_DATA: {
+        uint32_t t0 = micros();
+        onWsData(client, (AwsFrameInfo*)arg, data, len);
+        gTransport[Update::FromWs].inUs += micros() - t0;
+        break;
+      }
+      default:
+        break;
+    }
+  });
+  server.addHandler(&ws);
+
   server.begin();
   Serial.println("[HTTP] Server started");
 }
 
-// ---- Broadcast to BLE + SSE + Display ----
-void broadcastState() {
-  // Render
-  withState([](ScoreboardState& s){ renderer->render(s); });
+// ---- Sinks: Display, HTTP snapshot, BLE, SSE ----
+// Subscribers get a patch from the last version their sink sent to the current
+// one; a sink's very first message is a full state. Clients that see a patch
+// whose base is not their seq send {"type":"resync"} for a full state.
+struct PatchBase {
+  ScoreboardState last;
+  uint32_t version = 0;
+
+  // Fill `doc` with the update from `version` to `cur`; true if it is a full state.
+  bool update(JsonDocument& doc, const ScoreboardState& cur, uint32_t v) {
+    bool full = version == 0;
+    if (full) stateDoc(doc, cur, v); else patchDoc(doc, last, version, cur, v);
+    last = cur;
+    version = v;
+    return full;
+  }
+  // Nobody is listening: move the base along without building a message.
+  void skip(const ScoreboardState& cur, uint32_t v) { if (version) { last = cur; version = v; } }
+};
+
+// A network sink handled version `v`: its gate and the broadcast metrics.
+static void broadcastRan(SinkGate& gate, uint32_t v, uint32_t nowMs, uint32_t us) {
+  gMetrics.coalesced.add(gate.ran(v, nowMs, us));
+  gMetrics.broadcast.record(us);
+}
+
+void runDisplaySink() {
+  uint32_t now = millis();
+  if (!gDisplaySink.due(gStateVersion, now)) return;
+  uint32_t t0 = micros();
+  ScoreboardState cur;
+  uint32_t v = copyState(cur);
+  gTraces.stamp(trace::RenderStart, v, t0);
+  renderer->render(cur);
+  uint32_t us = micros() - t0;
+  gTraces.stamp(trace::RenderEnd, v, t0 + us);
+  gDisplaySink.ran(v, now, us);
+  gMetrics.render.record(us);
+}
+
+void runSnapshotSink() {
+  uint32_t now = millis();
+  if (!gSnapshotSink.due(gStateVersion, now)) return;
+  uint32_t t0 = micros();
+  ScoreboardState cur;
+  uint32_t v = copyState(cur);
+  publishSnapshot(cur, v);
+  broadcastRan(gSnapshotSink, v, now, micros() - t0);
+}
+
+// BLE: every central has its own gate, patch base and fragment queue. Replies
+// and state updates are split into fragments up front; the pump then sends one
+// fragment per central in turn, and a central whose notify is refused (its
+// controller buffers are full) is parked for a few ms while the others go on.
+// A central gets its next state update only once the previous one has gone
+// out, so a slow one receives fewer, larger patches instead of a backlog.
+struct BleTxQueue {
+  struct Fragment {
+    std::string bytes;
+    bool state;      // part of a state update
+    uint8_t count;   // fragments in its message; set on the last one only
+  };
+  uint32_t id = 0;   // BleLink::id this queue belongs to; 0 = free slot
+  uint16_t conn = BLE_HS_CONN_HANDLE_NONE;
+  uint16_t mtu = 23;
+  Codec codec = Codec::Json;
+  bool subscribed = false;
+  bool fresh = false;           // (re)subscribed: send a full state as soon as possible
+  uint8_t msgId = 0;            // fragment message id, wraps
+  PatchBase base;
+  std::deque<Fragment> frags;
+  uint32_t stateFrags = 0;      // fragments of the queued state update
+  uint32_t retryAtMs = 0;
+  uint32_t lastSentMs = 0;
+};
+
+static bool bleQueueMessage(BleTxQueue& q, BleLink& l, const std::string& payload, bool state) {
+  size_t packet = q.mtu > 3 ? q.mtu - 3 : 20;
+  size_t count = bleframe::fragmentCount(payload.size(), packet);
+  if (count > 255 || (!state && q.frags.size() + count > kBleBacklogMax)) {
+    l.tx.dropped++;
+    return false;
+  }
+  if (q.frags.empty()) q.lastSentMs = millis();  // stall clock starts now
+  bleframe::split((const uint8_t*)payload.data(), payload.size(), packet, q.msgId++,
+    [&](const uint8_t* p, size_t n) {
+      q.frags.push_back({ std::string((const char*)p, n), state, 0 });
+      return true;
+    });
+  q.frags.back().count = (uint8_t)count;
+  if (state) q.stateFrags += count;
+  return true;
+}
+
+// Round-robin one fragment per central until every queue is empty or parked.
+static void blePump(BleTxQueue* queues) {
+  for (bool progress = true; progress;) {
+    progress = false;
+    uint32_t now = millis();
+    for (size_t i = 0; i < kMaxBleLinks; i++) {
+      BleTxQueue& q = queues[i];
+      BleLink& l = gBleLinks[i];
+      if (q.frags.empty() || !q.subscribed || (int32_t)(now - q.retryAtMs) < 0) continue;
+      BleTxQueue::Fragment& f = q.frags.front();
+      if (!pTx->notify((const uint8_t*)f.bytes.data(), f.bytes.size(), q.conn)) {
+        l.tx.retries++;
+        gMetrics.bleNotifyFailed.add();
+        if (now - q.lastSentMs > kBleStallMs) {
+          Serial.printf("[BLE] conn %u stalled, dropping %u fragments\n", q.conn, (unsigned)q.frags.size());
+          l.tx.failures++;
+          gMetrics.bleStalled.add();
+          q.frags.clear();
+          q.stateFrags = 0;
+          q.base = PatchBase();  // the next update is a full state
+        } else {
+          q.retryAtMs = now + 3;
+        }
+        continue;
+      }
+      progress = true;
+      q.lastSentMs = now;
+      l.tx.fragments++;
+      l.tx.bytes += f.bytes.size();
+      l.tx.windowBytes += f.bytes.size();
+      if (now - l.tx.windowStartMs >= 1000) {
+        l.tx.bytesPerSec = l.tx.windowBytes * 1000UL / (now - l.tx.windowStartMs);
+        l.tx.windowStartMs = now;
+        l.tx.windowBytes = 0;
+      }
+      if (f.count) {
+        l.tx.messages++;
+#ifdef BLE_LOG_FRAGMENTS
+        if (f.count > 1) {
+          Serial.printf("[BLE] conn %u tx %u frags (mtu %u), avg %.1f frags/msg, %lu B/s, %lu retries\n",
+            q.conn, f.count, q.mtu, l.tx.fragments / (float)l.tx.messages,
+            (unsigned long)l.tx.bytesPerSec, (unsigned long)l.tx.retries);
+        }
+#endif
+      }
+      if (f.state) q.stateFrags--;
+      q.frags.pop_front();
+    }
+  }
+}
 
-  // BLE
-  if (pTx) {
-    String json = stateToJson();
-    pTx->setValue(json.c_str());
-    pTx->notify();
+// One line per central that sent anything since the last summary. The sink task
+// sleeps while idle, so the last window of a burst is logged on its next wake.
+static void bleLogStats(const BleTxQueue* queues, uint32_t now) {
+  static uint32_t loggedMs = 0;
+  uint32_t elapsed = now - loggedMs;
+  if (elapsed < kBleStatsLogMs) return;
+  for (size_t i = 0; i < kMaxBleLinks; i++) {
+    BleLink& l = gBleLinks[i];
+    const BleTxStats& t = l.tx;
+    uint32_t msgs = t.messages - l.txLogged.messages;
+    if (msgs && queues[i].id) {
+      uint32_t frags = t.fragments - l.txLogged.fragments;
+      Serial.printf("[BLE] conn %u: %lu msgs, %lu frags (avg %.1f/msg, mtu %u), %lu B/s, %lu retries in %lu ms\n",
+        queues[i].conn, (unsigned long)msgs, (unsigned long)frags, frags / (float)msgs, queues[i].mtu,
+        (unsigned long)((uint64_t)(t.bytes - l.txLogged.bytes) * 1000 / elapsed),
+        (unsigned long)(t.retries - l.txLogged.retries), (unsigned long)elapsed);
+    }
+    l.txLogged = t;
   }
+  loggedMs = now;
+}
 
-  // SSE
-  String json = stateToJson();
-  events.send(json.c_str(), "state");
+// Sleep until the first central can send a fragment or is due a state update.
+static uint32_t bleSinkWaitMs(const BleTxQueue* queues, uint32_t v, uint32_t now) {
+  uint32_t wait = SinkGate::kIdle;
+  for (size_t i = 0; i < kMaxBleLinks; i++) {
+    const BleTxQueue& q = queues[i];
+    if (!q.id || !q.subscribed) continue;
+    uint32_t w;
+    if (!q.frags.empty()) w = (int32_t)(q.retryAtMs - now) > 0 ? q.retryAtMs - now : 0;
+    else w = q.fresh ? 0 : gBleLinks[i].gate.waitMs(v, now);
+    if (w < wait) wait = w;
+  }
+  return wait;
 }
+
+void bleSinkLoop(void*) {
+  static BleTxQueue queues[kMaxBleLinks];
+  for (;;) {
+    uint32_t wait = bleSinkWaitMs(queues, gStateVersion, millis());
+    ulTaskNotifyTake(pdTRUE, wait == SinkGate::kIdle ? portMAX_DELAY : pdMS_TO_TICKS(wait));
+
+    // Follow the link table and take the queued replies.
+    std::vector<std::string> replies[kMaxBleLinks];
+    xSemaphoreTake(bleLinksMutex, portMAX_DELAY);
+    for (size_t i = 0; i < kMaxBleLinks; i++) {
+      BleLink& l = gBleLinks[i];
+      BleTxQueue& q = queues[i];
+      uint32_t id = l.conn == BLE_HS_CONN_HANDLE_NONE ? 0 : l.id;
+      if (q.id != id) { q = BleTxQueue(); q.id = id; }
+      q.conn = l.conn;
+      q.mtu = l.mtu;
+      q.codec = l.codec;
+      if (l.subscribed && !q.subscribed) { q.fresh = true; q.base = PatchBase(); }
+      q.subscribed = l.subscribed;
+      replies[i].swap(l.outbox);
+    }
+    xSemaphoreGive(bleLinksMutex);
+
+    uint32_t now = millis();
+    uint32_t v = gStateVersion;
+    ScoreboardState cur;
+    bool haveCur = false;
+    // Centrals at the same base and codec share one encoded update.
+    std::string built[kMaxBleLinks];
+    uint32_t builtFrom[kMaxBleLinks];
+    Codec builtCodec[kMaxBleLinks];
+    bool builtOk[kMaxBleLinks] = {};
+    uint32_t sentV = 0;
+    for (size_t i = 0; i < kMaxBleLinks; i++) {
+      BleTxQueue& q = queues[i];
+      BleLink& l = gBleLinks[i];
+      if (!q.id) continue;
+      for (auto& r : replies[i]) bleQueueMessage(q, l, r, false);
+      if (!q.subscribed || q.stateFrags || !(q.fresh || l.gate.due(v, now))) continue;
+      uint32_t t0 = micros();
+      if (!haveCur) { v = copyState(cur); haveCur = true; }
+      uint32_t from = q.base.version;
+      const std::string* msg = nullptr;
+      for (size_t j = 0; j < i && !msg; j++) {
+        if (builtOk[j] && builtFrom[j] == from && builtCodec[j] == q.codec) msg = &built[j];
+      }
+      if (msg) {
+        q.base.last = cur;
+        q.base.version = v;
+      } else {
+        JsonDocument doc;
+        q.base.update(doc, cur, v);
+        built[i] = encodeMessage(doc, q.codec);
+        builtFrom[i] = from;
+        builtCodec[i] = q.codec;
+        builtOk[i] = true;
+        msg = &built[i];
+      }
+      bleQueueMessage(q, l, *msg, true);
+      q.fresh = false;
+      broadcastRan(l.gate, v, now, micros() - t0);
+      sentV = v;
+    }
+
+    blePump(queues);
+    bleLogStats(queues, millis());
+    if (sentV) gTraces.stamp(trace::Ble, sentV, micros());
+    for (size_t i = 0; i < kMaxBleLinks; i++) gBleLinks[i].backlog = queues[i].frags.size();
+  }
+}
+
+// SSE and WebSocket clients each follow the sink's patch chain: clients on it
+// get the patch; clients off it (skipped, or just connected) get one full state
+// once their queue has room, so superseded updates never pile up in a slow
+// client's queue. `busy(c)` is true while c's send queue is full;
+// `send(c, payload, isPatch)` queues one message. Returns true while a client lags.
+template <typename Client, typename Busy, typename Send>
+static bool deliverToClients(std::vector<Client>& clients, const PatchBase& base, uint32_t from,
+                             const std::string& patch, bool full, Busy&& busy, Send&& send) {
+  std::string state = full ? patch : std::string();  // built on demand
+  bool lagging = false;
+  for (Client& c : clients) {
+    if (c.version == base.version) continue;
+    if (busy(c)) {
+      c.skipped++;
+      lagging = true;
+      continue;
+    }
+    if (!full && !patch.empty() && c.version == from) {
+      send(c, patch, true);
+    } else {
+      if (state.empty()) {
+        JsonDocument doc;
+        stateDoc(doc, base.last, base.version);
+        state = encodeMessage(doc, Codec::Json);
+      }
+      send(c, state, false);
+    }
+    c.version = base.version;
+  }
+  return lagging;
+}
+
+// SSE: one patch per sink run, recorded in the replay ring even when nobody is
+// connected (the usual reconnect is the only client dropping off).
+void sseSinkLoop(void*) {
+  PatchBase base;
+  bool lagging = false;
+  for (;;) {
+    uint32_t wait = gSseSink.waitMs(gStateVersion, millis());
+    if (lagging && wait > kLagRetryMs) wait = kLagRetryMs;
+    ulTaskNotifyTake(pdTRUE, wait == SinkGate::kIdle ? portMAX_DELAY : pdMS_TO_TICKS(wait));
+    uint32_t now = millis();
+    bool due = gSseSink.due(gStateVersion, now);
+    if (!due && !lagging) continue;
+    uint32_t t0 = micros();
+    uint32_t from = base.version;
+    bool full = false;
+    std::string patch;
+    if (due) {
+      ScoreboardState cur;
+      uint32_t v = copyState(cur);
+      JsonDocument doc;
+      full = base.update(doc, cur, v);
+      patch = encodeMessage(doc, Codec::Json);
+    }
+    xSemaphoreTake(sseMutex, portMAX_DELAY);
+    if (due) {
+      if (full) gSseReplay.clear(); else gSseReplay.push(from, base.version, patch);
+    }
+    lagging = deliverToClients(gSseClients, base, from, patch, full,
+      [](SseClient& c) { return c.client->packetsWaiting() >= kSseMaxQueued; },
+      [&](SseClient& c, const std::string& p, bool isPatch) {
+        c.client->send(p.c_str(), isPatch ? "patch" : "state", sseEventId(base.version));
+      });
+    xSemaphoreGive(sseMutex);
+    if (due) {
+      broadcastRan(gSseSink, base.version, now, micros() - t0);
+      gTraces.stamp(trace::Sse, base.version, micros());
+    }
+  }
+}
+
+// WebSocket: like SSE without the replay ring (a reconnect starts with the
+// full state). Also drops closed clients, as the library asks, once a second.
+void wsSinkLoop(void*) {
+  PatchBase base;
+  bool lagging = false;
+  uint32_t cleanupMs = 0;
+  for (;;) {
+    uint32_t wait = gWsSink.waitMs(gStateVersion, millis());
+    if (lagging && wait > kLagRetryMs) wait = kLagRetryMs;
+    if (wait > 1000) wait = 1000;
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
+    uint32_t now = millis();
+    if (now - cleanupMs >= 1000) {
+      ws.cleanupClients();
+      cleanupMs = now;
+    }
+    bool due = gWsSink.due(gStateVersion, now);
+    if (!due && !lagging) continue;
+    uint32_t t0 = micros();
+    uint32_t from = base.version;
+    bool full = false;
+    std::string patch;
+    if (due) {
+      ScoreboardState cur;
+      uint32_t v = copyState(cur);
+      if (ws.count() > 0) {
+        JsonDocument doc;
+        full = base.update(doc, cur, v);
+        patch = encodeMessage(doc, Codec::Json);
+      } else {
+        base.skip(cur, v);
+      }
+    }
+    xSemaphoreTake(wsMutex, portMAX_DELAY);
+    lagging = deliverToClients(gWsClients, base, from, patch, full,
+      [](WsClient& c) { return !ws.availableForWrite(c.id); },
+      [](WsClient& c, const std::string& p, bool) { ws.text(c.id, p.data(), p.size()); });
+    xSemaphoreGive(wsMutex);
+    if (due) {
+      broadcastRan(gWsSink, base.version, now, micros() - t0);
+      gTraces.stamp(trace::Ws, base.version, micros());
+    }
+  }
+}
+
+// Called after every mutation: nothing is sent here, sinks pick the newest
+// version up on their own schedule.
 void scheduleBroadcast() {
-  gPendingBroadcast = true;
+  uint32_t now = millis();
+  for (SinkGate* g : { &gDisplaySink, &gSnapshotSink, &gSseSink, &gWsSink }) g->pending(now);
+  for (BleLink& l : gBleLinks) l.gate.pending(now);
+  if (bleSinkTask) xTaskNotifyGive(bleSinkTask);
+  if (sseSinkTask) xTaskNotifyGive(sseSinkTask);
+  if (wsSinkTask) xTaskNotifyGive(wsSinkTask);
+}
+
+// Long-press on the panel clears the current set's score. It goes through the
+// state owner like a controller's command, so it is journaled and broadcast,
+// and undo from the PWA brings the score back.
+static void onPanelGesture(gesture::Kind g) {
+  if (g != gesture::LongPress) return;
+  ScoreboardState st;
+  copyState(st);
+  uint64_t ts = 0;  // the device keeps no clock: reuse the newest controller timestamp
+  for (uint8_t i = 0; i < st.laCount; i++) ts = max(ts, st.la[i].ts);
+  for (uint8_t i = 0; i < st.lbCount; i++) ts = max(ts, st.lb[i].ts);
+  char msg[80];
+  int n = snprintf(msg, sizeof(msg), "{\"type\":\"cmd\",\"op\":\"clearSet\",\"ts\":%llu}", (unsigned long long)ts);
+  if (!submitMessage(Update::FromLocal, (const uint8_t*)msg, n)) Serial.println("[TOUCH] update queue full, long-press dropped");
+}
+
+#ifdef STATE_STRESS_TEST
+// Hammers the write path from two net-core tasks (BLE-style patches in bursts of
+// 20 and HTTP-style full states, through the update queue) while loop() renders
+// and a reader on the render core copies the published state back to back.
+// Prints worst-case submit, apply and read latency and how many versions the
+// updates collapsed into, every 5 s. Fills the journal; bench only.
+struct {
+  volatile uint32_t writes, reads, readRetries, maxWriteUs, maxReadUs;
+} gStress;
+
+void stressWriter(void* arg) {
+  const bool patch = arg != nullptr;
+  char msg[128];
+  for (uint32_t i = 0;; i++) {
+    int n = patch ? snprintf(msg, sizeof(msg), "{\"type\":\"patch\",\"base\":0,\"data\":{\"a\":%u}}", (unsigned)(i % 100))
+                  : snprintf(msg, sizeof(msg), "{\"type\":\"state\",\"data\":{\"b\":%u,\"ta\":\"Stress %u\"}}",
+                             (unsigned)(i % 100), (unsigned)i);
+    uint32_t t0 = micros();
+    bool queued = submitMessage(Update::FromLocal, (const uint8_t*)msg, n);
+    uint32_t dt = micros() - t0;
+    if (queued) gStress.writes++;
+    if (dt > gStress.maxWriteUs) gStress.maxWriteUs = dt;
+    if (!patch || i % 20 == 19) vTaskDelay(pdMS_TO_TICKS(patch ? 50 : 1));
+  }
+}
+
+void stressReader(void*) {
+  ScoreboardState st;
+  for (;;) {
+    uint32_t t0 = micros();
+    uint32_t retries = gPublished.read([&](const PublishedState& p) { memcpy(&st, &p.st, sizeof(st)); });
+    uint32_t dt = micros() - t0;
+    gStress.readRetries += retries;
+    if (dt > gStress.maxReadUs) gStress.maxReadUs = dt;
+    if ((++gStress.reads & 255) == 0) vTaskDelay(1);
+  }
+}
+
+void stressReport(void*) {
+  for (;;) {
+    vTaskDelay(pdMS_TO_TICKS(5000));
+    Serial.printf("[STRESS] %lu submits (max %lu us, %lu rejected) -> %lu versions in %lu batches "
+                  "(max %lu/batch, apply max %lu us), %lu reads (max %lu us, %lu retries), display max %lu us\n",
+      (unsigned long)gStress.writes, (unsigned long)gStress.maxWriteUs, (unsigned long)gOwner.rejected,
+      (unsigned long)gOwner.versions, (unsigned long)gOwner.batches, (unsigned long)gOwner.maxBatch,
+      (unsigned long)gOwner.maxApplyUs, (unsigned long)gStress.reads,
+      (unsigned long)gStress.maxReadUs, (unsigned long)gStress.readRetries, (unsigned long)gDisplaySink.maxRunUs());
+    gStress.writes = gStress.reads = gStress.readRetries = gStress.maxWriteUs = gStress.maxReadUs = 0;
+    gOwner.versions = gOwner.batches = gOwner.maxBatch = gOwner.maxApplyUs = gOwner.rejected = 0;
+  }
+}
+
+void startStateStress() {
+  xTaskCreatePinnedToCore(stressWriter, "stress_ble", 6144, (void*)1, 1, nullptr, kNetCore);
+  xTaskCreatePinnedToCore(stressWriter, "stress_http", 6144, nullptr, 1, nullptr, kNetCore);
+  xTaskCreatePinnedToCore(stressReader, "stress_read", 4096, nullptr, 1, nullptr, kRenderCore);
+  xTaskCreatePinnedToCore(stressReport, "stress_report", 3072, nullptr, 1, nullptr, kNetCore);
+}
+#endif
+
+#if defined(CODEC_BENCH) || defined(HOT_PATH_BENCH)
+// A mid-match state: names, rotations and a full log (4 entries per team).
+void fillBenchState(ScoreboardState& full) {
+  setText(full.ta, "Hawks"); setText(full.tb, "Eagles"); full.a = 17; full.b = 15; full.set = 2; full.ma = 1;
+  for (int i=0;i<6;i++) { snprintf(full.ra[i], sizeof(full.ra[i]), "%d", i * 3 + 2); snprintf(full.rb[i], sizeof(full.rb[i]), "%d", i * 4 + 1); }
+  for (int i=0;i<4;i++) {
+    setText(full.la[i].reason, "Served and scored"); setText(full.la[i].scorer, "12"); full.la[i].ts = 1760000000000ULL + i * 30000;
+    setText(full.lb[i].reason, "Side out: gained serve"); full.lb[i].ts = 1760000005000ULL + i * 30000;
+  }
+  full.laCount = full.lbCount = 4;
+}
+#endif
+
+#ifdef CODEC_BENCH
+// Boot-time comparison of the JSON and MessagePack paths on a full state and a
+// one-point patch: bytes on the wire and microseconds per encode/decode.
+void runCodecBench() {
+  ScoreboardState full;
+  fillBenchState(full);
+  ScoreboardState next = full;
+  next.a++;
+  for (int i=1;i<4;i++) next.la[i-1] = next.la[i];
+  next.la[3].ts += 30000;
+
+  JsonDocument stateD, patchD;
+  stateDoc(stateD, full, 41);
+  patchDoc(patchD, full, 41, next, 42);
+  struct Case { const char* name; JsonDocument* doc; } cases[] = { {"state", &stateD}, {"patch", &patchD} };
+  const int N = 200;
+  for (auto& c : cases) {
+    for (Codec codec : { Codec::Json, Codec::MsgPack }) {
+      std::string wire = encodeMessage(*c.doc, codec);
+      uint32_t t0 = micros();
+      for (int i=0;i<N;i++) { std::string w = encodeMessage(*c.doc, codec); }
+      uint32_t enc = micros() - t0;
+      t0 = micros();
+      for (int i=0;i<N;i++) { JsonDocument d; decodeMessage(d, (const uint8_t*)wire.data(), wire.size(), codec); }
+      uint32_t dec = micros() - t0;
+      Serial.printf("[BENCH] %-5s %-7s %4u B  encode %6.1f us  decode %6.1f us\n",
+        c.name, codecName(codec), (unsigned)wire.size(), enc / (float)N, dec / (float)N);
+    }
+  }
+}
+#endif
+
+#ifdef HOT_PATH_BENCH
+// Boot-time microbenchmarks of the per-update paths: ns, heap allocations and
+// heap bytes per call, for a full state (rotations, 8 log entries) and a
+// score-only update. Runs before the state owner task and the journal start,
+// so it may drive S directly; S is put back afterwards. The display half runs
+// from setup() once the renderer is up (DisplayRenderer::benchRender).
+void runHotPathBench() {
+  ScoreboardState full;
+  fillBenchState(full);
+  const ScoreboardState saved = S;
+  const String fullMsg = stateToJson(full, 41);
+  const char* scoreMsg = "{\"type\":\"state\",\"data\":{\"a\":18}}";
+  const uint32_t N = 200;
+  Serial.printf("[BENCH] full state %u B, score-only update %u B\n", (unsigned)fullMsg.length(), (unsigned)strlen(scoreMsg));
+
+  JsonDocument fullDoc, scoreDoc;
+  deserializeJson(fullDoc, fullMsg);
+  deserializeJson(scoreDoc, scoreMsg);
+  String err;
+  bench::run("applyDataObject full", N, [&] { applyDataObject(fullDoc["data"].as<JsonObject>(), &err); });
+  bench::run("applyDataObject score-only", N, [&] { applyDataObject(scoreDoc["data"].as<JsonObject>(), &err); });
+
+  bench::run("stateToJson full", N, [&] { String json = stateToJson(full, 41); });
+
+  // The full state as a BLE central sends it: 4 framed writes, reassembled and
+  // parsed once, as RxCallbacks + the state owner do.
+  std::vector<std::vector<uint8_t>> frags;
+  size_t packet = (fullMsg.length() + 3) / 4 + bleframe::kHeader;
+  bleframe::split((const uint8_t*)fullMsg.c_str(), fullMsg.length(), packet, 1, [&](const uint8_t* p, size_t n) {
+    frags.emplace_back(p, p + n);
+    return true;
+  });
+  bleframe::Reassembler rx;
+  char name[40];
+  snprintf(name, sizeof(name), "updateStateFromJson %u-chunk BLE", (unsigned)frags.size());
+  bench::run(name, N, [&] {
+    for (auto& f : frags) rx.feed(f.data(), f.size(), millis());
+    MessageResult res;
+    updateStateFromJson(rx.data(), rx.size(), res);
+  });
+  bench::run("updateStateFromJson score-only", N, [&] {
+    MessageResult res;
+    updateStateFromJson((const uint8_t*)scoreMsg, strlen(scoreMsg), res);
+  });
+
+  bench::run("parseHexColor", 10 * N, [&] {
+    uint16_t c = 0;
+    parseHexColor("#42a5f5", &c);
+    bench::keep(c);
+  });
+  S = saved;
 }
+#endif
 
 void setup() {
   Serial.begin(115200);
   delay(300);
   Serial.println("\nBooting Scoreboard");
 
-  stateMutex = xSemaphoreCreateMutex();
+  {
+    PublishedState initial{ S, gStateVersion };
+    gPublished.store(initial);
+  }
+#ifdef CODEC_BENCH
+  runCodecBench();
+#endif
+#ifdef HOT_PATH_BENCH
+  runHotPathBench();
+#endif
+  snapshotMutex = xSemaphoreCreateMutex();
+  gTraces.begin();
+  bleLinksMutex = xSemaphoreCreateMutex();
+  sseMutex = xSemaphoreCreateMutex();
+  wsMutex = xSemaphoreCreateMutex();
 
   // SoftAP for fallback
   WiFi.mode(WIFI_AP);
   bool ap = WiFi.softAP(SOFTAP_SSID, SOFTAP_PASS);
   Serial.printf("[WiFi] SoftAP %s (%s)\n", ap ? "started" : "failed", WiFi.softAPIP().toString().c_str());
+  gBootId = (esp_random() & 0x7fffffff) | 1;  // the radio is up, so this is true entropy
+  Serial.printf("[BOOT] boot id %08x\n", (unsigned)gBootId);
 
+  {
+    ScoreboardState st;
+    uint32_t v = copyState(st);
+    publishSnapshot(st, v);  // HTTP/SSE readers never see an empty snapshot
+  }
+  if (gJournal.begin(journalSnapshot, kNetCore)) {
+    journal::Record boot(journal::Boot, gStateVersion);
+    gJournal.append(boot);
+  }
+  xTaskCreatePinnedToCore(stateOwnerLoop, "state_owner", 8192, nullptr, 2, &stateOwnerTask, kNetCore);
+  renderer->setGestureHandler(onPanelGesture);
   renderer->begin();
+#ifdef HOT_PATH_BENCH
+  {
+    ScoreboardState full;
+    fillBenchState(full);
+    renderer->benchRender(full);  // loop() has not started, so the renderer is ours
+  }
+#endif
   setupHTTP();
   setupBLE();
+  xTaskCreatePinnedToCore(bleSinkLoop, "sink_ble", 8192, nullptr, 1, &bleSinkTask, kNetCore);
+  xTaskCreatePinnedToCore(sseSinkLoop, "sink_sse", 6144, nullptr, 1, &sseSinkTask, kNetCore);
+  xTaskCreatePinnedToCore(wsSinkLoop, "sink_ws", 6144, nullptr, 1, &wsSinkTask, kNetCore);
+#ifdef STATE_STRESS_TEST
+  startStateStress();
+#endif
 
   // Push initial state
   scheduleBroadcast();
@@ -390,10 +2122,10 @@ void setup() {
 void loop() {
   // Poll display for touch to toggle views
   renderer->loop();
-  if (gPendingBroadcast) {
-    gPendingBroadcast = false;
-    broadcastState();
-  }
+  runSnapshotSink();
+  runDisplaySink();
+  finishTraces();
+  delay(1);
 }
 
 
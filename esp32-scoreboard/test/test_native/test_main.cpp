@@ -0,0 +1,427 @@
+// Unit tests for the pieces the simulator (src/host_main.cpp) only covers end
+// to end: message parsing and diffing, BLE reassembly, scoring and undo, the
+// SSE replay ring and the renderer's dirty tracking. On the PC:
+//
+//   pio test -e native
+//
+// The firmware in src/ is linked in (test_build_src); host_main.cpp steps
+// aside under PIO_UNIT_TESTING, and setup() never runs.
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "ble_frame.h"
+#include "display.h"
+#include "replay.h"
+#include "scoring.h"
+
+// src/main.cpp
+extern ScoreboardState S;
+bool applyDataObject(JsonObject data, String* err);
+void stateDoc(JsonDocument& doc, const ScoreboardState& s, uint32_t seq);
+void patchDoc(JsonDocument& doc, const ScoreboardState& prev, uint32_t base, const ScoreboardState& cur, uint32_t seq);
+
+void setUp() { S = ScoreboardState(); }
+void tearDown() {}
+
+namespace {
+
+bool apply(const char* json, String* err = nullptr) {
+  JsonDocument doc;
+  TEST_ASSERT_FALSE(deserializeJson(doc, json));
+  return applyDataObject(doc.as<JsonObject>(), err);
+}
+
+std::string repeat(char c, size_t n) { return std::string(n, c); }
+
+} // namespace
+
+// ---- applyDataObject ----
+
+void test_apply_rejects_bad_colors() {
+  const char* bad[] = { "{\"ca\":\"#12345\"}", "{\"cb\":\"red\"}", "{\"abg\":\"#12345g\"}", "{\"bbg\":\"12345678\"}" };
+  for (const char* json : bad) {
+    ScoreboardState before = S;
+    String err;
+    TEST_ASSERT_FALSE_MESSAGE(apply(json, &err), json);
+    TEST_ASSERT_TRUE(err.endsWith("must be #rrggbb"));
+    TEST_ASSERT_TRUE(S.ca == before.ca && S.cb == before.cb && S.abg == before.abg && S.bbg == before.bbg);
+  }
+}
+
+void test_apply_decodes_colors_once() {
+  TEST_ASSERT_TRUE(apply("{\"ca\":\"#00ff00\",\"bbg\":\"#FF0000\"}"));
+  TEST_ASSERT_EQUAL_STRING("#00ff00", S.ca.hex);
+  TEST_ASSERT_EQUAL_HEX16(0x07E0, S.ca.rgb565);
+  TEST_ASSERT_EQUAL_HEX16(0xF800, S.bbg.rgb565);
+}
+
+void test_apply_truncates_text() {
+  std::string json = "{\"ta\":\"" + repeat('n', 30) + "\",\"ra\":[\"12345\",\"7\"],"
+                     "\"la\":[{\"reason\":\"" + repeat('r', 40) + "\",\"scorer\":\"1234\",\"ts\":1}]}";
+  TEST_ASSERT_TRUE(apply(json.c_str()));
+  TEST_ASSERT_EQUAL(ScoreboardState::kNameLen, strlen(S.ta));
+  TEST_ASSERT_EQUAL_STRING("123", S.ra[0]);
+  TEST_ASSERT_EQUAL_STRING("7", S.ra[1]);
+  TEST_ASSERT_EQUAL_STRING("", S.ra[2]);
+  TEST_ASSERT_EQUAL(1, S.laCount);
+  TEST_ASSERT_EQUAL(ScoreboardState::kReasonLen, strlen(S.la[0].reason));
+  TEST_ASSERT_EQUAL_STRING("123", S.la[0].scorer);
+}
+
+void test_apply_clamps_numbers() {
+  TEST_ASSERT_TRUE(apply("{\"a\":150,\"b\":-3,\"set\":0,\"ma\":12,\"rsa\":9}"));
+  TEST_ASSERT_EQUAL(99, S.a);
+  TEST_ASSERT_EQUAL(0, S.b);
+  TEST_ASSERT_EQUAL(1, S.set);
+  TEST_ASSERT_EQUAL(9, S.ma);
+  TEST_ASSERT_EQUAL(5, S.rsa);
+  String err;
+  TEST_ASSERT_FALSE(apply("{\"bo\":4}", &err));
+  TEST_ASSERT_EQUAL_STRING("bo must be 3 or 5", err.c_str());
+}
+
+// ---- stateDoc / patchDoc ----
+
+void test_state_doc_has_every_field() {
+  JsonDocument doc;
+  stateDoc(doc, S, 7);
+  TEST_ASSERT_EQUAL_STRING("state", doc["type"] | "");
+  TEST_ASSERT_EQUAL(7, doc["seq"] | 0);
+  JsonObject data = doc["data"];
+  const char* keys[] = { "ta", "tb", "ca", "cb", "abg", "bbg", "a", "b", "sv", "set", "ma", "mb", "bo", "ra", "rb", "rsa", "rsb", "la", "lb" };
+  for (const char* k : keys) TEST_ASSERT_FALSE_MESSAGE(data[k].isNull(), k);
+}
+
+void test_patch_doc_sends_only_changes() {
+  ScoreboardState prev = S, cur = S;
+  JsonDocument same;
+  patchDoc(same, prev, 4, cur, 5);
+  TEST_ASSERT_EQUAL(0, same["data"].size());
+
+  cur.a = 5;
+  setText(cur.ra[2], "12");
+  JsonDocument doc;
+  patchDoc(doc, prev, 4, cur, 5);
+  TEST_ASSERT_EQUAL_STRING("patch", doc["type"] | "");
+  TEST_ASSERT_EQUAL(4, doc["base"] | 0);
+  TEST_ASSERT_EQUAL(5, doc["seq"] | 0);
+  JsonObject data = doc["data"];
+  TEST_ASSERT_EQUAL(2, data.size());
+  TEST_ASSERT_EQUAL(5, data["a"] | -1);
+  TEST_ASSERT_EQUAL(6, data["ra"].size());  // rotations go whole
+}
+
+void test_patch_doc_appends_logs() {
+  ScoreboardState prev = S;
+  for (int i = 0; i < 4; i++) scoring::addLog(prev, 'A', "Manual +1", "", 100 + i);
+  ScoreboardState cur = prev;
+  scoring::addLog(cur, 'A', "Served and scored", "7", 200);  // drops the oldest
+  JsonDocument doc;
+  patchDoc(doc, prev, 1, cur, 2);
+  JsonObject data = doc["data"];
+  TEST_ASSERT_TRUE(data["la"].isNull());
+  TEST_ASSERT_EQUAL(1, data["la+"].size());
+  TEST_ASSERT_EQUAL_STRING("7", data["la+"][0]["scorer"] | "");
+
+  // Applied on top of `prev`, the patch gives back `cur`.
+  S = prev;
+  TEST_ASSERT_TRUE(applyDataObject(data, nullptr));
+  TEST_ASSERT_EQUAL(4, S.laCount);
+  for (int i = 0; i < 4; i++) TEST_ASSERT_TRUE(S.la[i] == cur.la[i]);
+}
+
+// ---- bleframe::Reassembler ----
+
+namespace {
+
+std::vector<std::string> fragments(const std::string& msg, size_t packet, uint8_t id) {
+  std::vector<std::string> out;
+  bleframe::split((const uint8_t*)msg.data(), msg.size(), packet, id, [&](const uint8_t* p, size_t n) {
+    out.emplace_back((const char*)p, n);
+    return true;
+  });
+  return out;
+}
+
+bleframe::Reassembler::Result feed(bleframe::Reassembler& rx, const std::string& p, uint32_t nowMs) {
+  return rx.feed((const uint8_t*)p.data(), p.size(), nowMs);
+}
+
+std::string jsonOf(size_t n) { return "{\"ta\":\"" + repeat('x', n - 10) + "\"}"; }
+
+} // namespace
+
+void test_reassembler_in_order() {
+  static bleframe::Reassembler rx;
+  rx = bleframe::Reassembler();
+  std::string msg = jsonOf(300);
+  auto f = fragments(msg, 100, 1);
+  TEST_ASSERT_EQUAL(4, f.size());
+  for (size_t i = 0; i + 1 < f.size(); i++) TEST_ASSERT_EQUAL(bleframe::Reassembler::Pending, feed(rx, f[i], 0));
+  TEST_ASSERT_EQUAL(bleframe::Reassembler::Complete, feed(rx, f.back(), 0));
+  TEST_ASSERT_EQUAL_STRING(msg.c_str(), std::string((const char*)rx.data(), rx.size()).c_str());
+}
+
+void test_reassembler_out_of_order() {
+  static bleframe::Reassembler rx;
+  rx = bleframe::Reassembler();
+  auto f = fragments(jsonOf(300), 100, 2);
+  TEST_ASSERT_EQUAL(bleframe::Reassembler::Pending, feed(rx, f[0], 0));
+  TEST_ASSERT_EQUAL(bleframe::Reassembler::Error, feed(rx, f[2], 0));
+  TEST_ASSERT_EQUAL_STRING("fragment out of order", rx.error());
+  // The rest of the rejected message is dropped quietly, once.
+  TEST_ASSERT_EQUAL(bleframe::Reassembler::Pending, feed(rx, f[1], 0));
+  TEST_ASSERT_EQUAL(bleframe::Reassembler::Pending, feed(rx, f[3], 0));
+  TEST_ASSERT_EQUAL(1, rx.errors);
+  // The next message goes through.
+  for (auto& p : fragments(jsonOf(300), 100, 3)) feed(rx, p, 0);
+  TEST_ASSERT_EQUAL(1, rx.messages);
+}
+
+void test_reassembler_oversize() {
+  static bleframe::Reassembler rx;
+  rx = bleframe::Reassembler();
+  auto f = fragments(jsonOf(bleframe::Reassembler::kMaxMessage + 200), 185, 4);
+  int errors = 0;
+  for (auto& p : f) errors += feed(rx, p, 0) == bleframe::Reassembler::Error;
+  TEST_ASSERT_EQUAL(1, errors);
+  TEST_ASSERT_EQUAL_STRING("message too large", rx.error());
+  TEST_ASSERT_EQUAL(0, rx.messages);
+}
+
+void test_reassembler_timeout() {
+  static bleframe::Reassembler rx;
+  rx = bleframe::Reassembler();
+  auto f = fragments(jsonOf(300), 100, 5);
+  TEST_ASSERT_EQUAL(bleframe::Reassembler::Pending, feed(rx, f[0], 1000));
+  TEST_ASSERT_EQUAL(bleframe::Reassembler::Pending, feed(rx, f[1], 1000 + bleframe::Reassembler::kTimeoutMs));
+  TEST_ASSERT_EQUAL(bleframe::Reassembler::Error, feed(rx, f[2], 1001 + 2 * bleframe::Reassembler::kTimeoutMs));
+  TEST_ASSERT_EQUAL(1, rx.timeouts);
+  TEST_ASSERT_EQUAL(0, rx.messages);
+}
+
+void test_reassembler_unframed_chunks() {
+  static bleframe::Reassembler rx;
+  rx = bleframe::Reassembler();
+  // An old client chunking raw JSON: braces inside strings do not count.
+  TEST_ASSERT_EQUAL(bleframe::Reassembler::Pending, feed(rx, "{\"ta\":\"}{\\\"", 0));
+  TEST_ASSERT_EQUAL(bleframe::Reassembler::Pending, feed(rx, "\",\"ra\":[", 0));
+  TEST_ASSERT_EQUAL(bleframe::Reassembler::Complete, feed(rx, "]}trailing", 0));
+  TEST_ASSERT_EQUAL_STRING("{\"ta\":\"}{\\\"\",\"ra\":[]}", std::string((const char*)rx.data(), rx.size()).c_str());
+}
+
+// ---- scoring ----
+
+void test_scoring_points_stay_in_range() {
+  ScoreboardState s;
+  s.a = 99;
+  TEST_ASSERT_TRUE(scoring::apply(s, scoring::Op::Point, 'A', 1));
+  TEST_ASSERT_EQUAL(99, s.a);
+  TEST_ASSERT_TRUE(scoring::apply(s, scoring::Op::Minus, 'B', 2));
+  TEST_ASSERT_EQUAL(0, s.b);
+  TEST_ASSERT_FALSE(scoring::apply(s, scoring::Op::Point, 'C', 3));
+  TEST_ASSERT_EQUAL(scoring::Op::Unknown, scoring::opFromName("ace"));
+}
+
+void test_scoring_side_out_and_served() {
+  ScoreboardState s;
+  s.sv = 'A';
+  setText(s.rb[1], "12");
+  TEST_ASSERT_TRUE(scoring::apply(s, scoring::Op::SideOut, 'B', 1));
+  TEST_ASSERT_EQUAL('B', s.sv);
+  TEST_ASSERT_EQUAL(1, s.rsb);
+  TEST_ASSERT_TRUE(scoring::apply(s, scoring::Op::Served, 'B', 2));
+  TEST_ASSERT_EQUAL(1, s.b);
+  TEST_ASSERT_EQUAL_STRING("12", s.lb[s.lbCount - 1].scorer);
+  for (int i = 0; i < 5; i++) scoring::apply(s, scoring::Op::SideOut, 'B', 3);
+  TEST_ASSERT_EQUAL(0, s.rsb);  // wraps after six positions
+  TEST_ASSERT_EQUAL(4, s.lbCount);
+}
+
+void test_scoring_won_set_stays_at_nine() {
+  ScoreboardState s;
+  s.set = 9;
+  s.ma = 9;
+  s.a = 25;
+  TEST_ASSERT_TRUE(scoring::apply(s, scoring::Op::WonSet, 'A', 1));
+  TEST_ASSERT_EQUAL(9, s.set);
+  TEST_ASSERT_EQUAL(9, s.ma);
+  TEST_ASSERT_EQUAL(0, s.a);
+  s.b = 3;
+  TEST_ASSERT_TRUE(scoring::apply(s, scoring::Op::EndSet, 0, 2));
+  TEST_ASSERT_EQUAL(9, s.set);
+  TEST_ASSERT_EQUAL(1, s.mb);
+  TEST_ASSERT_TRUE(scoring::apply(s, scoring::Op::EndSet, 0, 3));  // a tie wins nothing
+  TEST_ASSERT_EQUAL(9, s.ma);
+  TEST_ASSERT_EQUAL(1, s.mb);
+}
+
+void test_scoring_undo_redo() {
+  ScoreboardState s;
+  scoring::History<4> h;
+  TEST_ASSERT_FALSE(h.undo(s));
+  for (int i = 0; i < 3; i++) {
+    h.record(scoring::Score::of(s));
+    scoring::apply(s, scoring::Op::Point, 'A', i);
+  }
+  setText(s.ta, "Renamed");  // not part of the score: undo leaves it
+  TEST_ASSERT_TRUE(h.undo(s));
+  TEST_ASSERT_TRUE(h.undo(s));
+  TEST_ASSERT_EQUAL(1, s.a);
+  TEST_ASSERT_EQUAL(1, s.laCount);
+  TEST_ASSERT_EQUAL_STRING("Renamed", s.ta);
+  TEST_ASSERT_TRUE(h.redo(s));
+  TEST_ASSERT_EQUAL(2, s.a);
+  // A new command forgets what could be redone.
+  h.record(scoring::Score::of(s));
+  scoring::apply(s, scoring::Op::Point, 'B', 9);
+  TEST_ASSERT_EQUAL(0, h.redoDepth());
+  TEST_ASSERT_FALSE(h.redo(s));
+}
+
+void test_scoring_history_forgets_oldest() {
+  ScoreboardState s;
+  scoring::History<4> h;
+  for (int i = 0; i < 6; i++) {
+    h.record(scoring::Score::of(s));
+    scoring::apply(s, scoring::Op::Point, 'A', i);
+  }
+  TEST_ASSERT_EQUAL(4, h.undoDepth());
+  while (h.undo(s)) {}
+  TEST_ASSERT_EQUAL(2, s.a);
+  TEST_ASSERT_EQUAL(4, h.redoDepth());
+}
+
+// ---- ReplayRing ----
+
+void test_replay_ring_replays_what_was_missed() {
+  ReplayRing ring(8, 1024);
+  TEST_ASSERT_FALSE(ring.replay(1, [](uint32_t, const std::string&) {}));
+  ring.push(1, 2, "p2");
+  ring.push(2, 3, "p3");
+  ring.push(3, 4, "p4");
+  std::vector<uint32_t> got;
+  auto collect = [&](uint32_t v, const std::string&) { got.push_back(v); };
+  TEST_ASSERT_TRUE(ring.replay(2, collect));
+  TEST_ASSERT_EQUAL(2, got.size());
+  TEST_ASSERT_EQUAL(3, got[0]);
+  TEST_ASSERT_EQUAL(4, got[1]);
+  got.clear();
+  TEST_ASSERT_TRUE(ring.replay(4, collect));  // already current
+  TEST_ASSERT_TRUE(got.empty());
+  TEST_ASSERT_FALSE(ring.replay(0, collect));
+  TEST_ASSERT_FALSE(ring.replay(9, collect));
+  TEST_ASSERT_TRUE(got.empty());
+}
+
+void test_replay_ring_restarts_a_broken_chain() {
+  ReplayRing ring(8, 1024);
+  ring.push(1, 2, "p2");
+  ring.push(2, 3, "p3");
+  ring.push(7, 8, "p8");
+  TEST_ASSERT_EQUAL(1, ring.size());
+  TEST_ASSERT_EQUAL(7, ring.oldest());
+  TEST_ASSERT_EQUAL(8, ring.newest());
+  TEST_ASSERT_FALSE(ring.replay(2, [](uint32_t, const std::string&) {}));
+}
+
+void test_replay_ring_bounds() {
+  ReplayRing byCount(3, 1024);
+  for (uint32_t v = 1; v <= 5; v++) byCount.push(v, v + 1, "p");
+  TEST_ASSERT_EQUAL(3, byCount.size());
+  TEST_ASSERT_EQUAL(3, byCount.oldest());
+
+  ReplayRing byBytes(32, 10);
+  for (uint32_t v = 1; v <= 5; v++) byBytes.push(v, v + 1, "abcd");
+  TEST_ASSERT_EQUAL(2, byBytes.size());
+  TEST_ASSERT_EQUAL(8, byBytes.bytes());
+  ReplayRing one(32, 10);
+  one.push(1, 2, repeat('x', 64));  // a patch bigger than the budget is still kept
+  TEST_ASSERT_EQUAL(1, one.size());
+}
+
+// ---- TftRenderer dirty widgets ----
+
+namespace {
+
+// Renders into the TFT_eSPI framebuffer stand-in through sprite bands.
+struct Panel {
+  TftRenderer r;
+  uint32_t W = 0, H = 0;
+  Panel() {
+    r.begin();
+    W = r.panel().width();
+    H = r.panel().height();
+  }
+  uint32_t frame(const ScoreboardState& s) {
+    r.render(s);
+    return r.stats().lastPixels;
+  }
+};
+
+Panel* gPanel = nullptr;
+
+} // namespace
+
+void test_render_full_frame_once() {
+  ScoreboardState s;
+  TEST_ASSERT_EQUAL_UINT32(gPanel->W * gPanel->H, gPanel->frame(s));
+  TEST_ASSERT_EQUAL_UINT32(0, gPanel->frame(s));  // nothing changed, nothing pushed
+}
+
+void test_render_score_repaints_its_bands() {
+  ScoreboardState s;
+  gPanel->frame(s);
+  s.a = 7;
+  uint32_t px = gPanel->frame(s);
+  TEST_ASSERT_TRUE(px > 0);
+  TEST_ASSERT_TRUE(px < gPanel->W * gPanel->H);
+  TEST_ASSERT_EQUAL_UINT32(0, px % (gPanel->W * 40));  // whole 40-row bands
+}
+
+void test_render_name_repaints_one_band() {
+  ScoreboardState s;
+  gPanel->frame(s);
+  setText(s.tb, "Visitors");
+  TEST_ASSERT_EQUAL_UINT32(gPanel->W * 40, gPanel->frame(s));
+}
+
+void test_render_background_repaints_everything() {
+  ScoreboardState s;
+  gPanel->frame(s);
+  setColor(s.abg, "#101010");
+  TEST_ASSERT_EQUAL_UINT32(gPanel->W * gPanel->H, gPanel->frame(s));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_apply_rejects_bad_colors);
+  RUN_TEST(test_apply_decodes_colors_once);
+  RUN_TEST(test_apply_truncates_text);
+  RUN_TEST(test_apply_clamps_numbers);
+  RUN_TEST(test_state_doc_has_every_field);
+  RUN_TEST(test_patch_doc_sends_only_changes);
+  RUN_TEST(test_patch_doc_appends_logs);
+  RUN_TEST(test_reassembler_in_order);
+  RUN_TEST(test_reassembler_out_of_order);
+  RUN_TEST(test_reassembler_oversize);
+  RUN_TEST(test_reassembler_timeout);
+  RUN_TEST(test_reassembler_unframed_chunks);
+  RUN_TEST(test_scoring_points_stay_in_range);
+  RUN_TEST(test_scoring_side_out_and_served);
+  RUN_TEST(test_scoring_won_set_stays_at_nine);
+  RUN_TEST(test_scoring_undo_redo);
+  RUN_TEST(test_scoring_history_forgets_oldest);
+  RUN_TEST(test_replay_ring_replays_what_was_missed);
+  RUN_TEST(test_replay_ring_restarts_a_broken_chain);
+  RUN_TEST(test_replay_ring_bounds);
+  gPanel = new Panel();
+  RUN_TEST(test_render_full_frame_once);
+  RUN_TEST(test_render_score_repaints_its_bands);
+  RUN_TEST(test_render_name_repaints_one_band);
+  RUN_TEST(test_render_background_repaints_everything);
+  delete gPanel;
+  return UNITY_END();
+}
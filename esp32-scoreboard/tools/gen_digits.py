@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Generate include/digits_font.h: anti-aliased score digits as 4-bit alpha masks.
+
+    python3 tools/gen_digits.py [--height 90] [--width 40] [--stroke 10] [--gap 8]
+
+Each digit is drawn as round-capped strokes (lines and elliptical arcs) and
+rasterised with 4x4 supersampling, so edges get 16 coverage levels. The masks
+are colour-free; the renderer blends them between the team colour and the
+panel background when it draws. Re-run after changing the size; the output is
+deterministic and checked in.
+"""
+import argparse
+import math
+import os
+
+SS = 4        # supersamples per axis
+ARC_STEPS = 48
+
+
+def arc(cx, cy, rx, ry, a0, a1):
+    """Points on an ellipse from angle a0 to a1 (degrees, 90 = top, y down)."""
+    pts = []
+    for i in range(ARC_STEPS + 1):
+        a = math.radians(a0 + (a1 - a0) * i / ARC_STEPS)
+        pts.append((cx + rx * math.cos(a), cy - ry * math.sin(a)))
+    return pts
+
+
+def strokes(d, W, H, s):
+    """Centre lines for digit d in a W x H box with stroke width s."""
+    l, r, t, b = s / 2, W - s / 2, s / 2, H - s / 2
+    cx, mid, rx = W / 2, H / 2, (r - l) / 2
+    ru, rl = (mid - t) / 2, (b - mid) / 2
+    if d == 0:
+        return [arc(cx, mid, rx, (b - t) / 2, 0, 360)]
+    if d == 1:
+        x = cx + s * 0.3
+        return [[(x, t), (x, b)], [(x - rx * 0.75, t + ru * 0.7), (x, t)]]
+    if d == 2:
+        top = arc(cx, t + ru, rx, ru, 165, -35)
+        return [top + [(l, b), (r, b)]]
+    if d == 3:
+        return [arc(cx, t + ru, rx * 0.92, ru, 155, -90), arc(cx, mid + rl, rx, rl, 90, -155)]
+    if d == 4:
+        x = r - rx * 0.45
+        y = mid + rl * 0.45
+        return [[(x, b), (x, t), (l, y), (r, y)]]
+    if d == 5:
+        ry = (b - mid + s * 0.6) / 2
+        bowl = arc(cx, b - ry, rx, ry, 145, -150)
+        return [[(r, t), (l + s * 0.2, t), (l, b - 2 * ry + s * 0.2)] + bowl[3:]]
+    if d == 6:
+        ry = (b - t) * 0.3
+        cy = b - ry
+        return [arc(cx, cy, rx, ry, 0, 360), arc(cx + rx * 0.15, cy, rx * 1.15, cy - t, 65, 175)]
+    if d == 7:
+        return [[(l, t), (r, t), (cx - rx * 0.3, b)]]
+    if d == 8:
+        return [arc(cx, t + ru, rx * 0.85, ru, 0, 360), arc(cx, mid + rl, rx, rl, 0, 360)]
+    if d == 9:
+        return [[(W - x, H - y) for x, y in line] for line in strokes(6, W, H, s)]
+    raise ValueError(d)
+
+
+def seg_dist2(px, py, ax, ay, bx, by):
+    dx, dy = bx - ax, by - ay
+    n = dx * dx + dy * dy
+    u = 0.0 if n == 0 else max(0.0, min(1.0, ((px - ax) * dx + (py - ay) * dy) / n))
+    ex, ey = ax + u * dx - px, ay + u * dy - py
+    return ex * ex + ey * ey
+
+
+def render(d, W, H, s):
+    segs = []
+    for line in strokes(d, W, H, s):
+        segs += [(line[i][0], line[i][1], line[i + 1][0], line[i + 1][1]) for i in range(len(line) - 1)]
+    r2 = (s / 2) ** 2
+    rows = []
+    for y in range(H):
+        row = []
+        for x in range(W):
+            hits = 0
+            for sy in range(SS):
+                for sx in range(SS):
+                    px, py = x + (sx + 0.5) / SS, y + (sy + 0.5) / SS
+                    if any(seg_dist2(px, py, *g) <= r2 for g in segs):
+                        hits += 1
+            row.append(round(hits * 15 / (SS * SS)))
+        rows.append(row)
+    return rows
+
+
+def pack(rows):
+    out = []
+    for row in rows:
+        if len(row) % 2:
+            row = row + [0]
+        out += [(row[i] << 4) | row[i + 1] for i in range(0, len(row), 2)]
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--height", type=int, default=90)
+    ap.add_argument("--width", type=int, default=40)
+    ap.add_argument("--stroke", type=int, default=10)
+    ap.add_argument("--gap", type=int, default=8)
+    ap.add_argument("--out", default=os.path.join(os.path.dirname(__file__), "..", "include", "digits_font.h"))
+    a = ap.parse_args()
+
+    row_bytes = (a.width + 1) // 2
+    lines = [
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        f"// Generated by tools/gen_digits.py --height {a.height} --width {a.width} --stroke {a.stroke} --gap {a.gap}.",
+        "// Do not edit; re-run the script instead.",
+        "//",
+        "// Score digits 0-9 as 4-bit alpha masks (0 = background, 15 = full colour),",
+        "// two pixels per byte, high nibble first, each row padded to a whole byte.",
+        "namespace digits {",
+        "",
+        f"constexpr int kWidth = {a.width};",
+        f"constexpr int kHeight = {a.height};",
+        f"constexpr int kGap = {a.gap};         // blank columns between two digits",
+        f"constexpr int kRowBytes = {row_bytes};",
+        "",
+        "static const uint8_t kGlyphs[10][kHeight * kRowBytes] PROGMEM = {",
+    ]
+    for d in range(10):
+        data = pack(render(d, a.width, a.height, a.stroke))
+        lines.append(f"  {{ // {d}")
+        for i in range(0, len(data), row_bytes):
+            lines.append("    " + ",".join(f"0x{v:02x}" for v in data[i:i + row_bytes]) + ",")
+        lines.append("  },")
+    lines += ["};", "", "} // namespace digits", ""]
+    with open(a.out, "w") as f:
+        f.write("\n".join(lines))
+    print(f"wrote {os.path.normpath(a.out)}: 10 glyphs {a.width}x{a.height}, {10 * a.height * row_bytes} bytes")
+
+
+if __name__ == "__main__":
+    main()
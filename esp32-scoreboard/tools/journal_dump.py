@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Decode a match journal exported from GET /api/v1/journal.
+
+    curl -o journal.bin http://192.168.4.1/api/v1/journal
+    python3 tools/journal_dump.py journal.bin
+
+Prints one line per record. The format is described in include/journal.h.
+"""
+import struct
+import sys
+from datetime import datetime, timezone
+
+MAGIC = 0xA5
+HEADER = 9
+FILE_MAGIC = b"VSJ1"
+TYPES = {1: "boot", 2: "snapshot", 3: "score", 4: "log", 5: "cmd", 6: "names"}
+OPS = ["point", "minus", "void", "sideout", "served", "wonSet", "clearSet", "endSet", "undo", "redo"]
+
+
+def crc16(data, crc=0xFFFF):
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+class Payload:
+    def __init__(self, data):
+        self.data, self.pos = data, 0
+
+    def u8(self):
+        self.pos += 1
+        return self.data[self.pos - 1]
+
+    def u64(self):
+        v, = struct.unpack_from("<Q", self.data, self.pos)
+        self.pos += 8
+        return v
+
+    def str(self):
+        n = self.u8()
+        self.pos += n
+        return self.data[self.pos - n:self.pos].decode("utf-8", "replace")
+
+
+def score(p):
+    a, b, st, ma, mb, sv, rsa, rsb = (p.u8() for _ in range(8))
+    return f"{a}-{b} set {st} match {ma}-{mb} serve {chr(sv)} rot {rsa}/{rsb}"
+
+
+def when(ms):
+    return datetime.fromtimestamp(ms / 1000, timezone.utc).strftime("%H:%M:%S") if ms else "-"
+
+
+def describe(kind, p):
+    if kind in ("snapshot",):
+        return f"{score(p)} '{p.str()}' vs '{p.str()}'"
+    if kind == "score":
+        return score(p)
+    if kind == "log":
+        team, ts, scorer, reason = chr(p.u8()), p.u64(), p.str(), p.str()
+        return f"{team} {when(ts)} {reason}" + (f" #{scorer}" if scorer else "")
+    if kind == "cmd":
+        op, team, ts = p.u8(), chr(p.u8()), p.u64()
+        name = OPS[op] if op < len(OPS) else f"op{op}"
+        return f"{name} {team.strip(chr(0))} {when(ts)}"
+    if kind == "names":
+        return f"'{p.str()}' vs '{p.str()}'"
+    return ""
+
+
+def main(path):
+    data = open(path, "rb").read()
+    pos, segments, bad = 0, 0, 0
+    floor = 0
+    while pos < len(data):
+        if data[pos:pos + 4] == FILE_MAGIC:
+            segments += 1
+            pos += 4
+            floor = None
+            print(f"--- segment {segments}")
+            continue
+        if len(data) - pos < HEADER or data[pos] != MAGIC:
+            # Torn tail of a segment: skip to the next one.
+            nxt = data.find(FILE_MAGIC, pos + 1)
+            bad += 1
+            pos = len(data) if nxt < 0 else nxt
+            continue
+        kind_id, length, seq, crc = struct.unpack_from("<BBIH", data, pos + 1)
+        body = data[pos + HEADER:pos + HEADER + length]
+        if len(body) != length or crc16(body, crc16(data[pos + 1:pos + 7])) != crc:
+            nxt = data.find(FILE_MAGIC, pos + 1)
+            bad += 1
+            pos = len(data) if nxt < 0 else nxt
+            continue
+        pos += HEADER + length
+        kind = TYPES.get(kind_id, f"type{kind_id}")
+        if kind == "snapshot":
+            floor = seq
+        elif floor is not None and kind != "boot" and seq < floor:
+            continue  # already folded into the segment's snapshot
+        print(f"{seq:8d} {kind:8s} {describe(kind, Payload(body))}")
+    print(f"{segments} segments, {bad} damaged tails", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        sys.exit(__doc__)
+    main(sys.argv[1])
@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+"""Compare round-trip latency and device time per update: WebSocket vs POST + SSE.
+
+    python3 tools/rtt_bench.py 192.168.4.1 [rounds]
+
+For each transport, sends `rounds` score updates one at a time and measures:
+- ack: until the reply to the request arrives (WebSocket ack / HTTP response)
+- update: until the broadcast carrying that version arrives (ws patch / SSE event)
+Then prints the device's own per-message averages from GET /api/v1/sinks
+("transports": handler time in, reply time out, queue-to-reply turn).
+"""
+import base64
+import json
+import os
+import socket
+import statistics
+import struct
+import sys
+import threading
+import time
+import urllib.request
+
+
+def get_json(host, path):
+    with urllib.request.urlopen(f"http://{host}{path}", timeout=3) as r:
+        return json.load(r)
+
+
+def summary(name, ms):
+    ms = sorted(ms)
+    if not ms:
+        return f"{name:>10}: no samples"
+    p95 = ms[min(len(ms) - 1, int(len(ms) * 0.95))]
+    return f"{name:>10}: median {statistics.median(ms):6.1f} ms  p95 {p95:6.1f} ms  max {ms[-1]:6.1f} ms"
+
+
+class Broadcasts:
+    """Arrival time of every broadcast version seen on a stream."""
+
+    def __init__(self):
+        self.seen = {}
+        self.cond = threading.Condition()
+
+    def add(self, msg):
+        seq = msg.get("seq")
+        if seq is None:
+            return
+        with self.cond:
+            self.seen.setdefault(seq, time.perf_counter())
+            self.cond.notify_all()
+
+    def wait(self, seq, timeout=2.0):
+        end = time.perf_counter() + timeout
+        with self.cond:
+            while True:
+                hits = [t for s, t in self.seen.items() if s >= seq]
+                if hits:
+                    return min(hits)
+                left = end - time.perf_counter()
+                if left <= 0:
+                    return None
+                self.cond.wait(left)
+
+
+# ---- WebSocket (RFC 6455, just enough for text frames) ----
+class WebSocket:
+    def __init__(self, host):
+        self.sock = socket.create_connection((host, 80), timeout=5)
+        key = base64.b64encode(os.urandom(16)).decode()
+        self.sock.sendall((f"GET /api/v1/ws HTTP/1.1\r\nHost: {host}\r\nUpgrade: websocket\r\n"
+                           f"Connection: Upgrade\r\nSec-WebSocket-Key: {key}\r\n"
+                           "Sec-WebSocket-Version: 13\r\n\r\n").encode())
+        self.rf = self.sock.makefile("rb")
+        status = self.rf.readline().decode()
+        if " 101" not in status:
+            raise ConnectionError(status.strip())
+        while self.rf.readline() not in (b"\r\n", b""):
+            pass
+
+    def send(self, text):
+        data = text.encode()
+        mask = os.urandom(4)
+        n = len(data)
+        head = bytes([0x81]) + (bytes([0x80 | n]) if n < 126 else bytes([0x80 | 126]) + struct.pack(">H", n))
+        self.sock.sendall(head + mask + bytes(b ^ mask[i % 4] for i, b in enumerate(data)))
+
+    def recv(self):
+        b0, b1 = self.rf.read(2)
+        n = b1 & 0x7F
+        if n == 126:
+            n = struct.unpack(">H", self.rf.read(2))[0]
+        elif n == 127:
+            n = struct.unpack(">Q", self.rf.read(8))[0]
+        payload = self.rf.read(n)
+        if b0 & 0x0F == 0x8:
+            raise ConnectionError("closed by device")
+        return payload
+
+
+def bench_ws(host, rounds):
+    ws = WebSocket(host)
+    ws.sock.settimeout(None)
+    acks, broadcasts = {}, Broadcasts()
+    ack_cond = threading.Condition()
+
+    def reader():
+        try:
+            while True:
+                msg = json.loads(ws.recv())
+                if msg.get("type") in ("state", "patch"):
+                    broadcasts.add(msg)
+                elif "id" in msg:
+                    with ack_cond:
+                        acks[msg["id"]] = (time.perf_counter(), msg.get("data", {}).get("seq"))
+                        ack_cond.notify_all()
+        except (OSError, ConnectionError, ValueError):
+            return
+
+    threading.Thread(target=reader, daemon=True).start()
+    ack_ms, update_ms = [], []
+    for i in range(1, rounds + 1):
+        t0 = time.perf_counter()
+        ws.send(json.dumps({"type": "state", "data": {"a": i % 100}, "id": i}))
+        with ack_cond:
+            if not ack_cond.wait_for(lambda: i in acks, timeout=2.0):
+                continue
+            t_ack, seq = acks.pop(i)
+        ack_ms.append((t_ack - t0) * 1000)
+        t_upd = broadcasts.wait(seq) if seq else None
+        if t_upd:
+            update_ms.append((t_upd - t0) * 1000)
+    return ack_ms, update_ms
+
+
+def bench_http(host, rounds):
+    broadcasts = Broadcasts()
+    sock = socket.create_connection((host, 80), timeout=5)
+    sock.sendall(f"GET /api/v1/events HTTP/1.1\r\nHost: {host}\r\nAccept: text/event-stream\r\n\r\n".encode())
+    rf = sock.makefile("rb")
+    sock.settimeout(None)
+
+    def reader():
+        try:
+            for line in rf:
+                if line.startswith(b"data:"):
+                    try:
+                        broadcasts.add(json.loads(line[5:]))
+                    except ValueError:
+                        pass
+        except OSError:
+            return
+
+    threading.Thread(target=reader, daemon=True).start()
+    ack_ms, update_ms = [], []
+    for i in range(1, rounds + 1):
+        body = json.dumps({"type": "state", "data": {"a": i % 100}, "id": i}).encode()
+        req = urllib.request.Request(f"http://{host}/api/v1/scoreboard", body, {"Content-Type": "application/json"})
+        t0 = time.perf_counter()
+        try:
+            with urllib.request.urlopen(req, timeout=3) as r:
+                seq = json.load(r).get("data", {}).get("seq")
+        except OSError:
+            continue
+        ack_ms.append((time.perf_counter() - t0) * 1000)
+        t_upd = broadcasts.wait(seq) if seq else None
+        if t_upd:
+            update_ms.append((t_upd - t0) * 1000)
+    sock.close()
+    return ack_ms, update_ms
+
+
+def main(host, rounds):
+    for name, bench in (("WebSocket", bench_ws), ("POST+SSE", bench_http)):
+        ack_ms, update_ms = bench(host, rounds)
+        print(f"{name} ({len(ack_ms)}/{rounds} acked)")
+        print(summary("ack", ack_ms))
+        print(summary("update", update_ms))
+    t = get_json(host, "/api/v1/sinks").get("transports", {})
+    print("device, per message (us):")
+    for name in ("ws", "http"):
+        if name in t:
+            s = t[name]
+            print(f"{name:>10}: in {s['inUs']:5d}  out {s['outUs']:5d}  turn {s['turnUs']:6d}  "
+                  f"max turn {s['maxTurnUs']:6d}  ({s['messages']} messages)")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) not in (2, 3):
+        sys.exit(__doc__)
+    main(sys.argv[1], int(sys.argv[2]) if len(sys.argv) == 3 else 200)
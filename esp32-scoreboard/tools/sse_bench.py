@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Find how many SSE clients the device can carry before it runs low on heap.
+
+    python3 tools/sse_bench.py 192.168.4.1 [max_clients]
+
+Opens /api/v1/events streams one at a time while posting a score change every
+100 ms, and after each new client prints the free heap, the largest free block
+and every client's send-queue depth from GET /api/v1/sinks. Stops when the
+device refuses a stream (client limit or low heap) or stops answering.
+"""
+import json
+import socket
+import sys
+import threading
+import time
+import urllib.request
+
+
+def get_json(host, path):
+    with urllib.request.urlopen(f"http://{host}{path}", timeout=3) as r:
+        return json.load(r)
+
+
+def post_score(host, a):
+    body = json.dumps({"type": "state", "data": {"a": a % 100}}).encode()
+    req = urllib.request.Request(f"http://{host}/api/v1/scoreboard", body, {"Content-Type": "application/json"})
+    with urllib.request.urlopen(req, timeout=3):
+        pass
+
+
+class Stream(threading.Thread):
+    """One EventSource-like client that counts the events it receives."""
+
+    def __init__(self, host):
+        super().__init__(daemon=True)
+        self.sock = socket.create_connection((host, 80), timeout=5)
+        self.sock.sendall(f"GET /api/v1/events HTTP/1.1\r\nHost: {host}\r\nAccept: text/event-stream\r\n\r\n".encode())
+        head = b""
+        while b"\r\n\r\n" not in head:
+            chunk = self.sock.recv(512)
+            if not chunk:
+                raise ConnectionError("closed")
+            head += chunk
+        status = head.split(b"\r\n", 1)[0].decode()
+        if " 200" not in status:
+            raise ConnectionError(status)
+        self.events = head.split(b"\r\n\r\n", 1)[1].count(b"id:")
+        self.sock.settimeout(None)
+        self.start()
+
+    def run(self):
+        try:
+            while True:
+                chunk = self.sock.recv(4096)
+                if not chunk:
+                    return
+                self.events += chunk.count(b"id:")
+        except OSError:
+            return
+
+
+def main(host, limit):
+    stop = threading.Event()
+
+    def writer():
+        a = 0
+        while not stop.is_set():
+            try:
+                post_score(host, a)
+            except OSError:
+                pass
+            a += 1
+            time.sleep(0.1)
+
+    threading.Thread(target=writer, daemon=True).start()
+    streams = []
+    print(f"{'clients':>7} {'heap':>7} {'minHeap':>7} {'maxBlk':>7}  queued per client")
+    try:
+        while len(streams) < limit:
+            try:
+                streams.append(Stream(host))
+            except (OSError, ConnectionError) as e:
+                print(f"client {len(streams) + 1} refused: {e}")
+                break
+            time.sleep(1.0)
+            try:
+                s = get_json(host, "/api/v1/sinks")
+            except OSError as e:
+                print(f"device stopped answering: {e}")
+                break
+            heap = s.get("heap", {})
+            queued = [c["queued"] for c in s.get("sse", {}).get("clients", [])]
+            print(f"{len(streams):7d} {heap.get('free', 0):7d} {heap.get('minFree', 0):7d} "
+                  f"{heap.get('maxAlloc', 0):7d}  {queued}")
+    finally:
+        stop.set()
+    time.sleep(1.0)
+    print(f"{len(streams)} clients held; events received: {[s.events for s in streams]}")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) not in (2, 3):
+        sys.exit(__doc__)
+    main(sys.argv[1], int(sys.argv[2]) if len(sys.argv) == 3 else 64)
@@ -0,0 +1,106 @@
+// Minimal MessagePack codec for the device's message envelope: maps, arrays,
+// strings, integers, floats, booleans and nil. Enough for state/patch/ack/error.
+
+const te = new TextEncoder();
+const td = new TextDecoder();
+
+export function encode(value) {
+  const out = [];
+  const u8 = (b) => out.push(b & 0xff);
+  const be = (v, bytes) => { for (let i = bytes - 1; i >= 0; i--) u8(Math.floor(v / 2 ** (8 * i))); };
+  const write = (v) => {
+    if (v === null || v === undefined) u8(0xc0);
+    else if (v === false) u8(0xc2);
+    else if (v === true) u8(0xc3);
+    else if (typeof v === 'number') {
+      if (Number.isInteger(v) && v >= 0) {
+        if (v < 0x80) u8(v);
+        else if (v < 0x100) { u8(0xcc); u8(v); }
+        else if (v < 0x10000) { u8(0xcd); be(v, 2); }
+        else if (v < 0x100000000) { u8(0xce); be(v, 4); }
+        else { u8(0xcf); be(v, 8); }
+      } else if (Number.isInteger(v) && v >= -0x80000000) {
+        if (v >= -32) u8(v);
+        else if (v >= -0x80) { u8(0xd0); u8(v); }
+        else if (v >= -0x8000) { u8(0xd1); be(v & 0xffff, 2); }
+        else { u8(0xd2); be(v >>> 0, 4); }
+      } else {
+        const b = new DataView(new ArrayBuffer(8));
+        b.setFloat64(0, v);
+        u8(0xcb);
+        for (let i = 0; i < 8; i++) u8(b.getUint8(i));
+      }
+    } else if (typeof v === 'string') {
+      const s = te.encode(v);
+      if (s.length < 32) u8(0xa0 | s.length);
+      else if (s.length < 0x100) { u8(0xd9); u8(s.length); }
+      else if (s.length < 0x10000) { u8(0xda); be(s.length, 2); }
+      else { u8(0xdb); be(s.length, 4); }
+      for (const b of s) u8(b);
+    } else if (Array.isArray(v)) {
+      if (v.length < 16) u8(0x90 | v.length);
+      else if (v.length < 0x10000) { u8(0xdc); be(v.length, 2); }
+      else { u8(0xdd); be(v.length, 4); }
+      v.forEach(write);
+    } else if (typeof v === 'object') {
+      const keys = Object.keys(v).filter((k) => v[k] !== undefined);
+      if (keys.length < 16) u8(0x80 | keys.length);
+      else if (keys.length < 0x10000) { u8(0xde); be(keys.length, 2); }
+      else { u8(0xdf); be(keys.length, 4); }
+      for (const k of keys) { write(k); write(v[k]); }
+    } else {
+      throw new Error('msgpack: cannot encode ' + typeof v);
+    }
+  };
+  write(value);
+  return new Uint8Array(out);
+}
+
+export function decode(bytes) {
+  const buf = bytes instanceof Uint8Array ? bytes : new Uint8Array(bytes.buffer || bytes, bytes.byteOffset || 0, bytes.byteLength);
+  const dv = new DataView(buf.buffer, buf.byteOffset, buf.byteLength);
+  let p = 0;
+  const str = (n) => { const s = td.decode(buf.subarray(p, p + n)); p += n; return s; };
+  const arr = (n) => { const a = []; for (let i = 0; i < n; i++) a.push(read()); return a; };
+  const map = (n) => { const o = {}; for (let i = 0; i < n; i++) { const k = read(); o[k] = read(); } return o; };
+  const read = () => {
+    const b = dv.getUint8(p++);
+    if (b < 0x80) return b;
+    if (b >= 0xe0) return b - 0x100;
+    if ((b & 0xf0) === 0x80) return map(b & 0x0f);
+    if ((b & 0xf0) === 0x90) return arr(b & 0x0f);
+    if ((b & 0xe0) === 0xa0) return str(b & 0x1f);
+    let v;
+    switch (b) {
+      case 0xc0: return null;
+      case 0xc2: return false;
+      case 0xc3: return true;
+      case 0xcc: return dv.getUint8(p++);
+      case 0xcd: v = dv.getUint16(p); p += 2; return v;
+      case 0xce: v = dv.getUint32(p); p += 4; return v;
+      case 0xcf: v = dv.getUint32(p) * 2 ** 32 + dv.getUint32(p + 4); p += 8; return v;
+      case 0xd0: return dv.getInt8(p++);
+      case 0xd1: v = dv.getInt16(p); p += 2; return v;
+      case 0xd2: v = dv.getInt32(p); p += 4; return v;
+      case 0xd3: v = dv.getInt32(p) * 2 ** 32 + dv.getUint32(p + 4); p += 8; return v;
+      case 0xca: v = dv.getFloat32(p); p += 4; return v;
+      case 0xcb: v = dv.getFloat64(p); p += 8; return v;
+      case 0xd9: return str(dv.getUint8(p++));
+      case 0xda: v = dv.getUint16(p); p += 2; return str(v);
+      case 0xdb: v = dv.getUint32(p); p += 4; return str(v);
+      case 0xdc: v = dv.getUint16(p); p += 2; return arr(v);
+      case 0xdd: v = dv.getUint32(p); p += 4; return arr(v);
+      case 0xde: v = dv.getUint16(p); p += 2; return map(v);
+      case 0xdf: v = dv.getUint32(p); p += 4; return map(v);
+      case 0xc4: v = dv.getUint8(p++); p += v; return buf.slice(p - v, p);
+      default: throw new Error('msgpack: unsupported type 0x' + b.toString(16));
+    }
+  };
+  return read();
+}
+
+// Same rule as the firmware: messages are maps, so a map marker means MessagePack.
+export function isMsgPack(bytes) {
+  const b = bytes[0];
+  return (b & 0xf0) === 0x80 || b === 0xde || b === 0xdf;
+}
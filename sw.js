@@ -1,11 +1,13 @@
-const CACHE = 'scoreboard-pwa-v1';
+const CACHE = 'scoreboard-pwa-v10';
 const ASSETS = [
   './',
   './index.html',
   './styles.css',
   './app.js',
   './ble.js',
+  './msgpack.js',
   './wifi.js',
+  './ws.js',
   './transport.js',
   './manifest.webmanifest',
 ];
@@ -1,28 +1,47 @@
 import { BleTransport } from './ble.js';
 import { WifiTransport } from './wifi.js';
+import { WsTransport } from './ws.js';
 
 export class Transport {
   constructor(log) {
     this.log = log || console;
     this.ble = new BleTransport(this.log);
     this.wifi = new WifiTransport(this.log);
+    this.ws = new WsTransport(this.log);
     this.active = null;
     this.onMessage = () => {};
     this.onStatus = () => {};
   }
 
   async connectBle() {
+    this.ws.close();
     this.active = this.ble;
     this._wire(this.ble);
     await this.ble.connect();
-    await this.ble.send({ type: 'hello', from: 'pwa' });
+    // Offer the compact binary encoding; the device's reply says which one it picked.
+    await this.ble.send({ type: 'hello', from: 'pwa', codecs: ['msgpack', 'json'] });
   }
 
-  async connectWifi(baseUrl) {
-    this.active = this.wifi;
-    this._wire(this.wifi);
-    await this.wifi.connect(baseUrl);
-    await this.wifi.send({ type: 'hello', from: 'pwa' });
+  // Wi‑Fi prefers the WebSocket (requests, replies and updates on one
+  // connection) and falls back to POST + SSE if the device refuses it or
+  // `websocket` is false.
+  async connectWifi(baseUrl, { websocket = true } = {}) {
+    this.active = null;
+    if (websocket) {
+      try {
+        this._wire(this.ws);
+        await this.ws.connect(baseUrl);
+        this.active = this.ws;
+      } catch (e) {
+        this.log.log('WebSocket unavailable, using POST + SSE:', e.message || e);
+      }
+    }
+    if (!this.active) {
+      this.active = this.wifi;
+      this._wire(this.wifi);
+      await this.wifi.connect(baseUrl);
+    }
+    await this.active.send({ type: 'hello', from: 'pwa' });
   }
 
   async send(obj) {
@@ -8,6 +8,7 @@ export class WifiTransport {
     this.onMessage = () => {};
     this.onStatus = () => {};
     this._pollTimer = null;
+    this.rtt = { last: 0, avg: 0, n: 0 };  // POST round trips, to compare with the WebSocket
   }
 
   async connect(baseUrl) {
@@ -23,16 +24,35 @@ export class WifiTransport {
   }
 
   status() {
-    return { kind: this.baseUrl ? 'connected' : 'disconnected', transport: 'wifi', baseUrl: this.baseUrl };
+    return { kind: this.baseUrl ? 'connected' : 'disconnected', transport: 'wifi', baseUrl: this.baseUrl, rtt: this.rtt };
   }
 
   async send(obj) {
     if (!this.baseUrl) throw new Error('Not connected (Wi‑Fi)');
-    await this._fetch('/api/v1/scoreboard', {
-      method: 'POST',
-      headers: { 'Content-Type': 'application/json' },
-      body: JSON.stringify(obj),
-    });
+    const t = performance.now();
+    let res;
+    try {
+      res = await this._fetch('/api/v1/scoreboard', {
+        method: 'POST',
+        headers: { 'Content-Type': 'application/json' },
+        body: JSON.stringify(obj),
+      });
+    } catch (e) {
+      // A refused write (409 stale, 400 bad field) is answered with an error
+      // message, as on BLE, so app.js can recover (e.g. push its full state).
+      if (e.body) this.onMessage(e.body);
+      throw e;
+    }
+    const ms = performance.now() - t;
+    // A traced write's ack carries the device-side stage timings; hand it on.
+    if (obj.cid) {
+      try { this.onMessage(await res.json()); } catch {}
+    }
+    const r = this.rtt;
+    r.last = ms;
+    r.n++;
+    r.avg += (ms - r.avg) / r.n;
+    if (r.n % 20 === 0) this.log.log(`POST rtt ${ms.toFixed(1)} ms, avg ${r.avg.toFixed(1)} ms over ${r.n}`);
   }
 
   _subscribe() {
@@ -40,13 +60,19 @@ export class WifiTransport {
     const sseUrl = this.baseUrl + '/api/v1/events';
     try {
       const es = new EventSource(sseUrl);
-      es.onmessage = (ev) => {
+      // The device names its events ('state', 'patch'), which onmessage never sees.
+      const deliver = (ev) => {
         try { this.onMessage(JSON.parse(ev.data)); }
         catch { this.onMessage({ type: 'text', data: ev.data }); }
       };
+      es.onmessage = deliver;
+      es.addEventListener('state', deliver);
+      es.addEventListener('patch', deliver);
+      // On a dropped link the browser reconnects by itself and sends
+      // Last-Event-ID, so the device replays only the missed patches. Poll only
+      // if the device refused the stream (too many clients, low memory).
       es.onerror = () => {
-        es.close();
-        this._beginPolling();
+        if (es.readyState === EventSource.CLOSED) this._beginPolling();
       };
     } catch {
       this._beginPolling();
@@ -54,12 +80,19 @@ export class WifiTransport {
   }
 
   _beginPolling() {
+    // 'no-cache' lets the browser revalidate with the device's ETag, so an
+    // unchanged state costs a 304 and is answered from the HTTP cache.
+    let lastSeq = null;  // "boot.seq": versions restart after a reboot
     const poll = async () => {
       try {
-        const res = await fetch(this.baseUrl + '/api/v1/state', { cache: 'no-store' });
+        const res = await fetch(this.baseUrl + '/api/v1/state', { cache: 'no-cache' });
         if (res.ok) {
           const obj = await res.json();
-          this.onMessage(obj);
+          const key = obj.seq === undefined ? undefined : `${obj.boot}.${obj.seq}`;
+          if (key === undefined || key !== lastSeq) {
+            lastSeq = key;
+            this.onMessage(obj);
+          }
         }
       } catch {}
       this._pollTimer = setTimeout(poll, 1000);
@@ -73,7 +106,13 @@ export class WifiTransport {
       mode: 'cors',
       cache: 'no-store',
     });
-    if (!res.ok) throw new Error(`HTTP ${res.status}`);
+    if (!res.ok) {
+      const err = new Error(`HTTP ${res.status}`);
+      if (res.status >= 400 && res.status < 500) {
+        try { err.body = await res.json(); } catch {}
+      }
+      throw err;
+    }
     return res;
   }
 }
@@ -0,0 +1,112 @@
+// WebSocket transport: the same message envelope as BLE, in both directions,
+// over one persistent connection to /api/v1/ws. Every request carries an "id"
+// that the device echoes in its ack/error, which gives the round-trip time.
+import { decode } from './msgpack.js';
+
+const CONNECT_TIMEOUT_MS = 3000;
+const RECONNECT_MS = 1000;
+const RTT_LOG_EVERY = 20;
+
+export class WsTransport {
+  constructor(log=console) {
+    this.log = log;
+    this.baseUrl = null;
+    this.ws = null;
+    this.closed = true;     // true once the user moved on; stops reconnecting
+    this.nextId = 1;
+    this.sent = new Map();  // request id -> send time
+    this.rtt = { last: 0, avg: 0, n: 0 };
+    this.onMessage = () => {};
+    this.onStatus = () => {};
+  }
+
+  async connect(baseUrl) {
+    if (!/^https?:\/\//i.test(baseUrl)) {
+      baseUrl = 'http://' + baseUrl;
+    }
+    this.baseUrl = baseUrl.replace(/\/+$/, '');
+    this.closed = false;
+    try {
+      await this._open();
+    } catch (e) {
+      this.closed = true;
+      throw e;
+    }
+  }
+
+  close() {
+    this.closed = true;
+    this.ws?.close();
+  }
+
+  status() {
+    return { kind: this.ws ? 'connected' : 'disconnected', transport: 'ws', baseUrl: this.baseUrl, rtt: this.rtt };
+  }
+
+  async send(obj) {
+    if (!this.ws || this.ws.readyState !== WebSocket.OPEN) throw new Error('Not connected (WebSocket)');
+    const id = this.nextId++;
+    this.sent.set(id, performance.now());
+    if (this.sent.size > 64) this.sent.delete(this.sent.keys().next().value);
+    this.ws.send(JSON.stringify({ ...obj, id }));
+  }
+
+  _open() {
+    const url = this.baseUrl.replace(/^http/i, 'ws') + '/api/v1/ws';
+    this.onStatus({ kind: 'connecting', transport: 'ws', baseUrl: this.baseUrl });
+    return new Promise((resolve, reject) => {
+      const ws = new WebSocket(url);
+      ws.binaryType = 'arraybuffer';
+      const timer = setTimeout(() => { ws.close(); reject(new Error('WebSocket connect timeout')); }, CONNECT_TIMEOUT_MS);
+      ws.onopen = () => {
+        clearTimeout(timer);
+        this.ws = ws;
+        this.onStatus({ kind: 'connected', transport: 'ws', baseUrl: this.baseUrl });
+        resolve();
+      };
+      ws.onmessage = (ev) => this._receive(ev.data);
+      ws.onclose = () => {
+        clearTimeout(timer);
+        if (this.ws !== ws) {
+          reject(new Error('WebSocket refused'));
+          return;
+        }
+        this.ws = null;
+        this.sent.clear();
+        this.onStatus({ kind: 'disconnected', transport: 'ws', baseUrl: this.baseUrl });
+        this._reconnect();
+      };
+    });
+  }
+
+  // The device starts every new connection with a full state, so nothing is
+  // lost across a reconnect.
+  _reconnect() {
+    if (this.closed) return;
+    setTimeout(() => this._open().catch(() => this._reconnect()), RECONNECT_MS);
+  }
+
+  _receive(data) {
+    let msg;
+    try {
+      msg = typeof data === 'string' ? JSON.parse(data) : decode(new Uint8Array(data));
+    } catch {
+      this.onMessage({ type: 'text', data: String(data) });
+      return;
+    }
+    const t = msg?.id !== undefined ? this.sent.get(msg.id) : undefined;
+    if (t !== undefined) {
+      this.sent.delete(msg.id);
+      this._recordRtt(performance.now() - t);
+    }
+    this.onMessage(msg);
+  }
+
+  _recordRtt(ms) {
+    const r = this.rtt;
+    r.last = ms;
+    r.n++;
+    r.avg += (ms - r.avg) / r.n;
+    if (r.n % RTT_LOG_EVERY === 0) this.log.log(`WebSocket rtt ${ms.toFixed(1)} ms, avg ${r.avg.toFixed(1)} ms over ${r.n}`);
+  }
+}